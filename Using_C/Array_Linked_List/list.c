@@ -0,0 +1,698 @@
+/**
+ * @file list.c
+ * @author Akash_Thorat
+ * @brief Implementation of an array backed linked list data structure and associated functions.
+ * @version 0.1
+ * @date 2024-05-22
+ *
+ * This file contains the implementation of an array backed linked list along with
+ * various functions for manipulating and operating on the list. It provides
+ * functions for creating a new list, inserting elements at the beginning and end,
+ * removing elements, searching for elements, adding two list, concating one list to another,
+ * revering the list, sorting the list, and more.
+ *
+ * Like the Singly_Linked_List, the list header tracks the last node and the number
+ * of elements, so that appending, reading the last element and querying the size
+ * take constant time. The nodes are taken from the free list of indices first, then
+ * from the slots never used, and the array is doubled by realloc() once both are
+ * exhausted. The helpers work on indices only, a node address is taken after the
+ * slots it needs were allocated. Destroying the list releases every node with a
+ * single free().
+ *
+ * compact_list() and shrink_to_fit() copy the nodes in traversal order into a new
+ * array, so that walking the list reads memory sequentially. sort() sorts the
+ * elements in a flat array and writes them back the same way, so a sorted list is
+ * compacted as well. parallel_sort() sorts segments of the flat array on separate
+ * threads and merges them pairwise in rounds, as the Unrolled_Linked_List does.
+ *
+ * This file serves as the backend implementation for the array backed linked list
+ * and is intended to be used in conjunction with the corresponding header file (list.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+#include "workers.h"
+
+// Function to create a new list whose array holds the dummy node
+list_t* create_list(void)
+{
+    list_t* p_list = NULL;
+
+    p_list = (list_t*) xcalloc(1, sizeof(list_t));
+    p_list->p_nodes = (node_t*) xcalloc(LIST_MIN_CAPACITY, sizeof(node_t));
+    p_list->p_nodes[NODE_NONE].data = 0;        // Initialize the dummy node
+    p_list->p_nodes[NODE_NONE].next = NODE_NONE;
+    p_list->capacity = LIST_MIN_CAPACITY;
+    p_list->nr_used = 1;
+    p_list->free_index = NODE_NONE;
+    p_list->tail = NODE_NONE;
+    p_list->nr_elements = 0;
+
+    return (p_list);
+}
+
+// Insert a new node with data at the beginning of the list
+status_t insert_start(list_t* p_list, data_t new_data)
+{
+    generic_insert(p_list, NODE_NONE, get_new_node(p_list, new_data));
+    return (SUCCESS);
+}
+
+// Insert a new node with data at the end of the list
+status_t insert_end(list_t* p_list, data_t new_data)
+{
+    generic_insert(p_list, p_list->tail, get_new_node(p_list, new_data));
+    return (SUCCESS);
+}
+
+// Insert a new node with new_data after the first occurrence of e_data in the list
+status_t insert_after(list_t* p_list, data_t e_data, data_t new_data)
+{
+    uint32_t prev = NODE_NONE;
+    uint32_t e_index = NODE_NONE;
+    int found = 0;
+
+    prev = search_prev_node(p_list, e_data, &found);
+    if (!found)
+        return (LIST_DATA_NOT_FOUND);
+    e_index = p_list->p_nodes[prev].next;
+    generic_insert(p_list, e_index, get_new_node(p_list, new_data));
+    return (SUCCESS);
+}
+
+// Insert a new node with new_data before the first occurrence of e_data in the list
+status_t insert_before(list_t* p_list, data_t e_data, data_t new_data)
+{
+    uint32_t prev = NODE_NONE;
+    int found = 0;
+
+    prev = search_prev_node(p_list, e_data, &found);
+    if (!found)
+        return (LIST_DATA_NOT_FOUND);
+    generic_insert(p_list, prev, get_new_node(p_list, new_data));
+    return (SUCCESS);
+}
+
+// Get the data from the first node in the list
+status_t get_start(list_t* p_list, data_t* p_start_data)
+{
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    *p_start_data = p_list->p_nodes[p_list->p_nodes[NODE_NONE].next].data;
+    return (SUCCESS);
+}
+
+// Get the data from the last node in the list
+status_t get_end(list_t* p_list, data_t* p_end_data)
+{
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    *p_end_data = p_list->p_nodes[p_list->tail].data;
+    return (SUCCESS);
+}
+
+// Remove and return the data from the first node in the list
+status_t pop_start(list_t* p_list, data_t* p_start_data)
+{
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    *p_start_data = p_list->p_nodes[p_list->p_nodes[NODE_NONE].next].data;
+    delete_next_node(p_list, NODE_NONE);
+    return (SUCCESS);
+}
+
+// Remove and return the data from the last node in the list, its predecessor is found by walking the list
+status_t pop_end(list_t* p_list, data_t* p_end_data)
+{
+    uint32_t prev = NODE_NONE;
+
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    while (p_list->p_nodes[prev].next != p_list->tail)
+        prev = p_list->p_nodes[prev].next;
+    *p_end_data = p_list->p_nodes[p_list->tail].data;
+    delete_next_node(p_list, prev);
+    return (SUCCESS);
+}
+
+// Remove the first node in the list
+status_t remove_start(list_t* p_list)
+{
+    data_t data = 0;
+    return (pop_start(p_list, &data));
+}
+
+// Remove the last node in the list
+status_t remove_end(list_t* p_list)
+{
+    data_t data = 0;
+    return (pop_end(p_list, &data));
+}
+
+// Remove the first occurrence of a node with data equal to r_data from the list
+status_t remove_data(list_t* p_list, data_t r_data)
+{
+    uint32_t prev = NODE_NONE;
+    int found = 0;
+
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    prev = search_prev_node(p_list, r_data, &found);
+    if (!found)
+        return (LIST_DATA_NOT_FOUND);
+    delete_next_node(p_list, prev);
+    return (SUCCESS);
+}
+
+// Search for a node containing data equal to f_data in the list
+int search_data(list_t* p_list, data_t f_data)
+{
+    int found = 0;
+    search_prev_node(p_list, f_data, &found);
+    return (found);
+}
+
+// Count the nodes containing data equal to c_data in the list
+len_t count_data(list_t* p_list, data_t c_data)
+{
+    const node_t* p_nodes = p_list->p_nodes;
+    uint32_t run = NODE_NONE;
+    len_t count = 0;
+
+    for (run = p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_nodes[run].next)
+        if (p_nodes[run].data == c_data)
+            count = count + 1;
+    return (count);
+}
+
+// Add given two list in new list and retuen new list
+list_t* add_lists(list_t* p_list_1, list_t* p_list_2)
+{
+    list_t* p_new_list = NULL;
+    uint32_t run = NODE_NONE;
+
+    p_new_list = create_list();
+    reserve(p_new_list, size(p_list_1) + size(p_list_2));
+
+    for(run = p_list_1->p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_list_1->p_nodes[run].next)
+        insert_end(p_new_list, p_list_1->p_nodes[run].data);
+
+    for(run = p_list_2->p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_list_2->p_nodes[run].next)
+        insert_end(p_new_list, p_list_2->p_nodes[run].data);
+
+    return (p_new_list);
+}
+
+// Concatenates the second list to the end of the first list, its nodes are copied into slots never used of the first array
+void concat_lists(list_t* p_list_1, list_t* p_list_2)
+{
+    node_t* p_nodes = NULL;
+    uint32_t first = NODE_NONE;
+    uint32_t index = NODE_NONE;
+    uint32_t run = NODE_NONE;
+
+    if(is_list_empty(p_list_2))
+        return;
+
+    reserve(p_list_1, size(p_list_2));
+    p_nodes = p_list_1->p_nodes;
+    first = p_list_1->nr_used;
+    index = first;
+    for(run = p_list_2->p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_list_2->p_nodes[run].next)
+    {
+        p_nodes[index].data = p_list_2->p_nodes[run].data;
+        p_nodes[index].next = index + 1;
+        index = index + 1;
+    }
+    p_nodes[index - 1].next = NODE_NONE;
+
+    p_nodes[p_list_1->tail].next = first;
+    p_list_1->tail = index - 1;
+    p_list_1->nr_used = index;
+    p_list_1->nr_elements = p_list_1->nr_elements + p_list_2->nr_elements;
+
+    // The second list keeps its array, every slot of it is free again
+    p_list_2->p_nodes[NODE_NONE].next = NODE_NONE;
+    p_list_2->nr_used = 1;
+    p_list_2->free_index = NODE_NONE;
+    p_list_2->tail = NODE_NONE;
+    p_list_2->nr_elements = 0;
+}
+
+// Return new list by merging two list
+list_t* get_merged_list(list_t* p_list_1, list_t* p_list_2)
+{
+    list_t* p_list = NULL;
+
+    p_list = add_lists(p_list_1, p_list_2);
+    sort(p_list);
+
+    return (p_list);
+}
+
+// Return Reversed List(Reversed by value)
+list_t* get_reversed_list(list_t* p_list)
+{
+    list_t* p_new_list = NULL;
+    uint32_t run = NODE_NONE;
+
+    p_new_list = create_list();
+    reserve(p_new_list, size(p_list));
+    for(run = p_list->p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_list->p_nodes[run].next)
+        insert_start(p_new_list, p_list->p_nodes[run].data);
+
+    return (p_new_list);
+}
+
+// reverce the list(Reversed by node)
+void reverse_list(list_t* p_list)
+{
+    node_t* p_nodes = p_list->p_nodes;
+    uint32_t run = NODE_NONE;
+    uint32_t run_next = NODE_NONE;
+    uint32_t prev = NODE_NONE;
+
+    if(size(p_list) <= 1)
+        return;
+
+    run = p_nodes[NODE_NONE].next;
+    p_list->tail = run;          // First node becomes the last one
+
+    while(run != NODE_NONE)
+    {
+        run_next = p_nodes[run].next;
+        p_nodes[run].next = prev;
+        prev = run;
+        run = run_next;
+    }
+    p_nodes[NODE_NONE].next = prev;
+}
+
+// Sort the list, elements are sorted in a flat array and written back into slots 1 ... size
+void sort(list_t* p_list)
+{
+    data_t* p_array = NULL;
+
+    if(size(p_list) <= 1)
+        return;
+
+    p_array = copy_to_array(p_list);
+    qsort(p_array, size(p_list), sizeof(data_t), compare_data);
+    copy_from_array(p_list, p_array);
+    free(p_array);
+}
+
+// Define a sorted run of parallel_sort(), a range of the array holding the current round
+struct sort_segment {
+    len_t begin;                         // Index of the first element of the run
+    len_t length;                        // Number of elements of the run
+};
+
+// Define the state shared by the tasks of parallel_sort()
+struct parallel_sort {
+    data_t* p_data;                      // Array holding the runs of the current round
+    data_t* p_buffer;                    // Array receiving the merged runs, swapped with p_data after every round
+    struct sort_segment* p_runs;         // Runs of the current round
+    int nr_runs;                         // Number of runs of the current round
+    int nr_parts;                        // Number of parts of every merge of the current round
+};
+
+// Define a task of parallel_sort(), it sorts a segment or merges a part of two runs
+struct sort_task {
+    struct parallel_sort* p_sort;        // State shared by the tasks
+    int id;                              // Segment sorted, or merge * nr_parts + part for a merge round
+};
+
+// Sort the list on nr_threads threads of the worker pool, the sorted segments are merged in rounds and every merge is split by rank
+void parallel_sort(list_t* p_list, int nr_threads)
+{
+    struct parallel_sort state;
+    struct sort_task* p_tasks = NULL;
+    len_t length = 0;
+    len_t begin = 0;
+
+    length = size(p_list);
+    if (nr_threads > length / PARALLEL_SORT_MIN_SEGMENT)
+        nr_threads = length / PARALLEL_SORT_MIN_SEGMENT;
+    if (nr_threads <= 1)
+    {
+        sort(p_list);
+        return;
+    }
+
+    state.p_data = copy_to_array(p_list);
+    state.p_buffer = (data_t*) xcalloc(length, sizeof(data_t));
+    state.p_runs = (struct sort_segment*) xcalloc(nr_threads, sizeof(struct sort_segment));
+    state.nr_runs = nr_threads;
+    p_tasks = (struct sort_task*) xcalloc(nr_threads, sizeof(struct sort_task));
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        state.p_runs[i].begin = begin;
+        state.p_runs[i].length = length / nr_threads + (i < length % nr_threads);
+        begin = begin + state.p_runs[i].length;
+        p_tasks[i].p_sort = &state;
+        p_tasks[i].id = i;
+    }
+
+    workers_run(sort_segment_task, p_tasks, sizeof(struct sort_task), nr_threads);
+    while (state.nr_runs > 1)
+        merge_round(&state, p_tasks, nr_threads);
+
+    copy_from_array(p_list, state.p_data);
+    free(p_tasks);
+    free(state.p_runs);
+    free(state.p_buffer);
+    free(state.p_data);
+}
+
+// Move the nodes to slots 1 ... size in traversal order, the free list is emptied and the array keeps its capacity
+void compact_list(list_t* p_list)
+{
+    relayout(p_list, p_list->capacity);
+}
+
+// Compact the list into an array of exactly size + 1 slots, releasing the slots it does not use
+void shrink_to_fit(list_t* p_list)
+{
+    relayout(p_list, (uint32_t) size(p_list) + 1);
+}
+
+// Check if the list is empty
+int is_list_empty(list_t* p_list)
+{
+    return (p_list->p_nodes[NODE_NONE].next == NODE_NONE);
+}
+
+// Get the size/length of the list
+len_t size(list_t* p_list)
+{
+    return (p_list->nr_elements);
+}
+
+// Display the contents of the list
+void show(list_t* p_list, const char* msg)
+{
+    uint32_t run = NODE_NONE;
+    if (msg)
+        puts(msg);
+    printf("[START]->");
+    for (run = p_list->p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_list->p_nodes[run].next)
+        printf("[%d]->", p_list->p_nodes[run].data);
+    puts("[END]");
+}
+
+// Destroy the list, all its nodes are released at once with the array
+status_t destroy_list(list_t** pp_list)
+{
+    list_t* p_list = NULL;
+
+    p_list = *pp_list;
+    free(p_list->p_nodes);
+    free(p_list);
+    *pp_list = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Link the node at new_index between the node at prev and the node which follows it
+static void generic_insert(list_t* p_list, uint32_t prev, uint32_t new_index)
+{
+    node_t* p_nodes = p_list->p_nodes;
+
+    p_nodes[new_index].next = p_nodes[prev].next;
+    p_nodes[prev].next = new_index;
+    if (p_nodes[new_index].next == NODE_NONE)
+        p_list->tail = new_index;
+    p_list->nr_elements = p_list->nr_elements + 1;
+}
+
+// Unlink the node after the node at prev and put its slot on the free list
+static void delete_next_node(list_t* p_list, uint32_t prev)
+{
+    node_t* p_nodes = p_list->p_nodes;
+    uint32_t index = NODE_NONE;
+
+    index = p_nodes[prev].next;
+    p_nodes[prev].next = p_nodes[index].next;
+    if (p_list->tail == index)
+        p_list->tail = prev;
+
+    p_nodes[index].next = p_list->free_index;
+    p_list->free_index = index;
+    p_list->nr_elements = p_list->nr_elements - 1;
+}
+
+// Search for the node before the first node containing s_data, *p_found is set to 0 if there is none
+static uint32_t search_prev_node(list_t* p_list, data_t s_data, int* p_found)
+{
+    const node_t* p_nodes = p_list->p_nodes;
+    uint32_t prev = NODE_NONE;
+
+    for (prev = NODE_NONE; p_nodes[prev].next != NODE_NONE; prev = p_nodes[prev].next)
+    {
+        if (p_nodes[p_nodes[prev].next].data == s_data)
+        {
+            *p_found = 1;
+            return (prev);
+        }
+    }
+    *p_found = 0;
+    return (NODE_NONE);
+}
+
+// Take a slot from the free list, or the next slot never used, and store new_data in it
+static uint32_t get_new_node(list_t* p_list, data_t new_data)
+{
+    uint32_t index = NODE_NONE;
+
+    if (p_list->free_index != NODE_NONE)
+    {
+        index = p_list->free_index;
+        p_list->free_index = p_list->p_nodes[index].next;
+    }
+    else
+    {
+        if (p_list->nr_used == p_list->capacity)
+            reserve(p_list, 1);
+        index = p_list->nr_used;
+        p_list->nr_used = p_list->nr_used + 1;
+    }
+
+    p_list->p_nodes[index].data = new_data;
+    p_list->p_nodes[index].next = NODE_NONE;
+    return (index);
+}
+
+// Grow the array until nr_nodes slots after the ones already used fit, the capacity is doubled each time
+static void reserve(list_t* p_list, uint32_t nr_nodes)
+{
+    uint64_t needed = 0;
+    uint64_t capacity = 0;
+
+    needed = (uint64_t) p_list->nr_used + nr_nodes;
+    if (needed <= p_list->capacity)
+        return;
+    if (needed > LIST_MAX_CAPACITY)
+    {
+        puts("ERROR too many nodes in the list ..!");
+        exit(EXIT_FAILURE);
+    }
+
+    capacity = p_list->capacity;
+    while (capacity < needed)
+        capacity = capacity * 2;
+    if (capacity > LIST_MAX_CAPACITY)
+        capacity = LIST_MAX_CAPACITY;
+
+    p_list->p_nodes = (node_t*) xrealloc(p_list->p_nodes, capacity * sizeof(node_t));
+    p_list->capacity = (uint32_t) capacity;
+}
+
+// Copy the nodes in traversal order to slots 1 ... size of a new array of capacity slots, which replaces the old one
+static void relayout(list_t* p_list, uint32_t capacity)
+{
+    node_t* p_nodes = NULL;
+    uint32_t run = NODE_NONE;
+    uint32_t index = 0;
+
+    p_nodes = (node_t*) xcalloc(capacity, sizeof(node_t));
+    for (run = p_list->p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_list->p_nodes[run].next)
+    {
+        p_nodes[index].next = index + 1;
+        index = index + 1;
+        p_nodes[index].data = p_list->p_nodes[run].data;
+    }
+    p_nodes[index].next = NODE_NONE;
+
+    free(p_list->p_nodes);
+    p_list->p_nodes = p_nodes;
+    p_list->capacity = capacity;
+    p_list->nr_used = index + 1;
+    p_list->free_index = NODE_NONE;
+    p_list->tail = index;
+}
+
+// Compare two elements for qsort
+static int compare_data(const void* p_data_1, const void* p_data_2)
+{
+    data_t data_1 = *(const data_t*) p_data_1;
+    data_t data_2 = *(const data_t*) p_data_2;
+    return ((data_1 > data_2) - (data_1 < data_2));
+}
+
+// Copy the elements of the list, in order, to a new array
+static data_t* copy_to_array(list_t* p_list)
+{
+    data_t* p_array = NULL;
+    uint32_t run = NODE_NONE;
+    len_t length = 0;
+
+    p_array = (data_t*) xcalloc(size(p_list), sizeof(data_t));
+    for(run = p_list->p_nodes[NODE_NONE].next; run != NODE_NONE; run = p_list->p_nodes[run].next)
+    {
+        p_array[length] = p_list->p_nodes[run].data;
+        length = length + 1;
+    }
+    return (p_array);
+}
+
+// Rewrite the list from an array into slots 1 ... size linked in order, the free list is emptied
+static void copy_from_array(list_t* p_list, const data_t* p_array)
+{
+    node_t* p_nodes = p_list->p_nodes;
+    uint32_t length = (uint32_t) size(p_list);
+
+    // Slots 1 ... size were used already, so they fit in the array
+    p_nodes[NODE_NONE].next = 1;
+    for (uint32_t i = 1; i <= length; ++i)
+    {
+        p_nodes[i].data = p_array[i - 1];
+        p_nodes[i].next = i + 1;
+    }
+    p_nodes[length].next = NODE_NONE;
+
+    p_list->nr_used = length + 1;
+    p_list->free_index = NODE_NONE;
+    p_list->tail = length;
+}
+
+// Merge the sorted arrays p_run1 and p_run2 into p_out, equal elements keep their order
+static void merge_arrays(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, data_t* p_out)
+{
+    len_t i = 0;
+    len_t j = 0;
+
+    while (i < length1 && j < length2)
+        *p_out++ = (p_run1[i] <= p_run2[j]) ? p_run1[i++] : p_run2[j++];
+    memcpy(p_out, p_run1 + i, (length1 - i) * sizeof(data_t));
+    memcpy(p_out + (length1 - i), p_run2 + j, (length2 - j) * sizeof(data_t));
+}
+
+// Sort one segment of the array
+static void sort_segment_task(void* p_task)
+{
+    struct sort_task* p_this = (struct sort_task*) p_task;
+    struct parallel_sort* p_sort = p_this->p_sort;
+    struct sort_segment* p_run = &p_sort->p_runs[p_this->id];
+
+    qsort(p_sort->p_data + p_run->begin, p_run->length, sizeof(data_t), compare_data);
+}
+
+// Merge the runs pairwise into the other array, every merge is split into parts merged by separate tasks
+static void merge_round(struct parallel_sort* p_sort, struct sort_task* p_tasks, int nr_threads)
+{
+    // An odd run is merged with an empty one, so the tasks copy it as well
+    int nr_merges = (p_sort->nr_runs + 1) / 2;
+    data_t* p_swap = NULL;
+
+    p_sort->nr_parts = nr_threads / nr_merges;
+    workers_run(merge_part_task, p_tasks, sizeof(struct sort_task), nr_merges * p_sort->nr_parts);
+
+    // Run i is read before it is overwritten, by merge i / 2
+    for (int i = 0; i < nr_merges; ++i)
+    {
+        p_sort->p_runs[i].begin = p_sort->p_runs[2 * i].begin;
+        p_sort->p_runs[i].length = p_sort->p_runs[2 * i].length;
+        if (2 * i + 1 < p_sort->nr_runs)
+            p_sort->p_runs[i].length = p_sort->p_runs[i].length + p_sort->p_runs[2 * i + 1].length;
+    }
+    p_sort->nr_runs = nr_merges;
+
+    p_swap = p_sort->p_data;
+    p_sort->p_data = p_sort->p_buffer;
+    p_sort->p_buffer = p_swap;
+}
+
+// Merge one part of two adjacent runs into the other array, the part is found by rank in both runs
+static void merge_part_task(void* p_task)
+{
+    struct sort_task* p_this = (struct sort_task*) p_task;
+    struct parallel_sort* p_sort = p_this->p_sort;
+    int merge = p_this->id / p_sort->nr_parts;
+    int part = p_this->id % p_sort->nr_parts;
+    struct sort_segment* p_run = &p_sort->p_runs[2 * merge];
+    const data_t* p_run1 = p_sort->p_data + p_run->begin;
+    const data_t* p_run2 = p_run1 + p_run->length;
+    len_t length1 = p_run->length;
+    len_t length2 = (2 * merge + 1 < p_sort->nr_runs) ? p_run[1].length : 0;
+    len_t begin = part_rank(length1 + length2, part, p_sort->nr_parts);
+    len_t end = part_rank(length1 + length2, part + 1, p_sort->nr_parts);
+    len_t begin1 = split_rank(p_run1, length1, p_run2, length2, begin);
+    len_t end1 = split_rank(p_run1, length1, p_run2, length2, end);
+
+    merge_arrays(p_run1 + begin1, end1 - begin1, p_run2 + (begin - begin1), (end - end1) - (begin - begin1),
+                 p_sort->p_buffer + p_run->begin + begin);
+}
+
+// Return how many elements of p_run1 come first among the first rank elements of the merge of both runs
+static len_t split_rank(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, len_t rank)
+{
+    len_t low = (rank > length2) ? rank - length2 : 0;
+    len_t high = (rank < length1) ? rank : length1;
+    len_t mid = 0;
+
+    // Binary search into both runs, the element of p_run1 goes first when they are equal
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+        if (p_run1[mid] <= p_run2[rank - mid - 1])
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return (low);
+}
+
+// Return the first rank of a part when total elements are split into nr_parts parts
+static len_t part_rank(len_t total, int part, int nr_parts)
+{
+    return ((len_t) ((long long) total * part / nr_parts));
+}
+
+// Allocate memory for an array with specified number of elements and size per element
+void* xcalloc(int nr_of_element, len_t size_per_element)
+{
+    void* p = NULL;
+    p = calloc(nr_of_element, size_per_element);
+    if (p == NULL)
+    {
+        puts("ERROR while allocating memory ..!");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+// Resize the memory at p to new_size bytes, its content is kept
+void* xrealloc(void* p, size_t new_size)
+{
+    p = realloc(p, new_size);
+    if (p == NULL)
+    {
+        puts("ERROR while allocating memory ..!");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file list.h
+ * @author Akash_Thorat
+ * @brief Header file defining an array backed linked list data structure and associated functions.
+ * @version 0.1
+ * @date 2024-05-22
+ *
+ * This header file contains the declarations for a linked list whose nodes live
+ * in one growable array and are linked by 32 bit indices instead of pointers. A
+ * node takes 8 bytes instead of 16, and since no node holds an address the whole
+ * list is a single contiguous buffer which can be moved by realloc(), written to
+ * a file or mapped into another process as it is. It provides the same interface
+ * as the Singly_Linked_List for creating a new list, inserting elements, removing
+ * elements, searching for elements, sorting the list, and more.
+ *
+ * Slot 0 of the array is the dummy node. No node ever links back to it, so index
+ * 0 also marks the end of the list and the end of the free list. Removed nodes are
+ * kept on a free list of indices and handed out again by the next insertion, the
+ * array only grows once the free list is empty and every slot was used. Indices
+ * stay valid while the array grows, but node addresses do not, so they must not
+ * be kept across an insertion.
+ *
+ * Additionally, the header file defines helper routines used internally by the
+ * interface functions and includes necessary typedefs and structure definitions.
+ *
+ * This header file serves as the interface for using the array backed linked list
+ * and is intended to be included in source files where linked list functionality
+ * is required. It should be used in conjunction with the corresponding source file
+ * (list.c) for full functionality.
+ */
+
+
+#ifndef _LIST_H
+#define _LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PARALLEL_SORT_MIN_SEGMENT 4096   // Smallest number of elements sorted by one thread of parallel_sort()
+#define LIST_MIN_CAPACITY 16             // Number of slots of the array of a new list
+#define LIST_MAX_CAPACITY 0x7fffffffu    // Upper limit for the number of slots, the dummy node included
+#define NODE_NONE 0u                     // Index of the dummy node, also the end of the list and of the free list
+
+// Define the structure of a node in the linked list
+struct node {
+    int data;            // Data stored in the node
+    uint32_t next;       // Index of the next node in the array (NODE_NONE for the last node)
+};
+
+// Define the header of the linked list, kept separate from the array of nodes
+struct list {
+    struct node* p_nodes;    // Array of nodes, p_nodes[0] is the dummy node and p_nodes[0].next the first node
+    uint32_t capacity;       // Number of slots of the array
+    uint32_t nr_used;        // Number of slots handed out at least once, slots from nr_used on were never used
+    uint32_t free_index;     // First slot of the free list, linked through next (NODE_NONE when it is empty)
+    uint32_t tail;           // Index of the last node (NODE_NONE when the list is empty)
+    int nr_elements;         // Number of nodes currently in the list
+};
+
+struct sort_segment;         // Sorted run of parallel_sort(), defined in list.c
+struct parallel_sort;        // State of parallel_sort(), defined in list.c
+struct sort_task;            // Task of parallel_sort(), defined in list.c
+
+// Define typedefs for clarity and abstraction
+typedef enum status {SUCCESS = 1, LIST_EMPTY, LIST_DATA_NOT_FOUND} status_t;  // Status codes for list operations
+typedef struct node node_t;  // Typedef for node structure
+typedef struct list list_t;   // Typedef for the entire linked list
+typedef int data_t;           // Typedef for data stored in nodes
+typedef int len_t;            // Typedef for length/size of the list
+
+// Function prototypes for the operations that can be performed on the list
+list_t* create_list(void);  // Create a new linked list
+status_t insert_start(list_t* p_list, data_t new_data);     // Insert data at the beginning of the list
+status_t insert_end(list_t* p_list, data_t new_data);       // Insert data at the end of the list
+status_t insert_after(list_t* p_list, data_t e_data, data_t new_data);  // Insert data after a specific value
+status_t insert_before(list_t* p_list, data_t e_data, data_t new_data); // Insert data before a specific value
+status_t get_start(list_t* p_list, data_t* p_start_data);   // Get the first element of the list
+status_t get_end(list_t* p_list, data_t* p_end_data);       // Get the last element of the list
+status_t pop_start(list_t* p_list, data_t* p_start_data);   // Remove and retrieve the first element of the list
+status_t pop_end(list_t* p_list, data_t* p_end_data);       // Remove and retrieve the last element of the list
+status_t remove_start(list_t* p_list);                      // Remove the first element of the list
+status_t remove_end(list_t* p_list);                        // Remove the last element of the list
+status_t remove_data(list_t* p_list, data_t r_data);         // Remove a specific value from the list
+int search_data(list_t* p_list, data_t f_data);             // Search for a specific value in the list
+len_t count_data(list_t* p_list, data_t c_data);            // Count the occurrences of a specific value in the list
+
+list_t* add_lists(list_t* p_list_1, list_t* p_list_2);      // Add given two list in new list and retuen new list
+void concat_lists(list_t* p_list_1, list_t* p_list_2);      // Concatenates the second list to the end of the first list
+list_t* get_merged_list(list_t* p_list_1, list_t* p_list_2); // Return new list by merging two list
+list_t* get_reversed_list(list_t* p_list);             // Return Reversed List(Reversed by value)
+void reverse_list(list_t* p_list);                     // reverce the list(Reversed by node)
+void sort(list_t* p_list);                                  // Sort the list
+void parallel_sort(list_t* p_list, int nr_threads);         // Sort the list on nr_threads threads, same result as sort()
+void compact_list(list_t* p_list);                          // Move the nodes to slots 1 ... size in traversal order, emptying the free list
+void shrink_to_fit(list_t* p_list);                         // Compact the list and release the slots it does not use
+
+int is_list_empty(list_t* p_list);                          // Check if the list is empty
+len_t size(list_t* p_list);                                 // Get the size/length of the list
+void show(list_t* p_list, const char* msg);                  // Display the contents of the list
+status_t destroy_list(list_t** pp_list);                    // Destroy the list and free memory
+
+
+// Helper routines used internally by the interface functions
+static void generic_insert(list_t* p_list, uint32_t prev, uint32_t new_index);  // Link a new node after the node at prev
+static void delete_next_node(list_t* p_list, uint32_t prev);       // Unlink the node after prev and put it on the free list
+static uint32_t search_prev_node(list_t* p_list, data_t s_data, int* p_found); // Search for the node before the one containing specific data
+static uint32_t get_new_node(list_t* p_list, data_t new_data);      // Take a slot from the free list or the array and store data in it
+static void reserve(list_t* p_list, uint32_t nr_nodes);             // Grow the array so that nr_nodes more nodes fit without growing again
+static void relayout(list_t* p_list, uint32_t capacity);            // Copy the nodes in traversal order into a new array of capacity slots
+static int compare_data(const void* p_data_1, const void* p_data_2); // Compare two elements for qsort
+static data_t* copy_to_array(list_t* p_list);                       // Copy the elements of the list to a new array
+static void copy_from_array(list_t* p_list, const data_t* p_array); // Rewrite the list from an array into slots 1 ... size
+static void merge_arrays(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, data_t* p_out); // Merge two sorted arrays
+static void sort_segment_task(void* p_task);                         // Sort one segment of parallel_sort()
+static void merge_round(struct parallel_sort* p_sort, struct sort_task* p_tasks, int nr_threads); // Merge the runs of parallel_sort() pairwise
+static void merge_part_task(void* p_task);                          // Merge one part of two runs
+static len_t split_rank(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, len_t rank); // Elements of p_run1 among the first rank merged elements
+static len_t part_rank(len_t total, int part, int nr_parts);        // First rank of a part of a merge
+void* xcalloc(int nr_of_elemet, len_t size_per_element);             // Helper function to allocate memory
+void* xrealloc(void* p, size_t new_size);                            // Helper function to resize memory
+
+#endif /*_LIST_H*/
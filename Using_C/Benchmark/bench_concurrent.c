@@ -0,0 +1,252 @@
+/**
+ * @file bench_concurrent.c
+ * @author Akash_Thorat
+ * @brief A program to measure the throughput of a list shared by several threads.
+ * @version 0.1
+ * @date 2024-05-06
+ *
+ * This program runs a mix of inserts, removals and searches of random keys on a
+ * single list shared by 1, 2, 4, ... threads and reports the total throughput.
+ * The same source is compiled against the lock free list and, with BENCH_MUTEX
+ * defined, against the singly linked list where every call is wrapped in one
+ * global mutex (see the Makefile), LIST_VARIANT holding the name of the variant.
+ *
+ * The list is filled with half of the keys first, inserts and removals are equally
+ * likely so that its size stays about the same. One record is printed per number
+ * of threads, either as CSV or as JSON lines.
+ *
+ * Usage : bench_concurrent [--format csv|json] [--max-threads N] [--keys N]
+ *                          [--ops N] [--update-percent P] [--no-header]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "list.h"
+#ifndef BENCH_MUTEX
+#include "epoch.h"
+#endif
+
+#ifndef LIST_VARIANT
+#define LIST_VARIANT "list"
+#endif
+
+// Define the work of one thread
+typedef struct bench_thread {
+    list_t* p_list;              // List shared by the threads
+    long nr_ops;                 // Number of operations to run
+    int nr_keys;                 // Keys are taken from 0 ... nr_keys - 1
+    int update_percent;          // Percentage of inserts and removals
+    unsigned int seed;           // Seed of the random keys of the thread
+    pthread_barrier_t* p_barrier; // Start of the measurement
+} bench_thread_t;
+
+static long long now_ns(void);
+static unsigned int next_random(unsigned int* p_seed);
+static void* bench_worker(void* p_arg);
+static void run_threads(int nr_threads, long nr_ops, int nr_keys, int update_percent, const char* format);
+
+//------------------------- operations of the set -------------------------
+
+#ifdef BENCH_MUTEX
+static pthread_mutex_t list_mutex = PTHREAD_MUTEX_INITIALIZER;  // Serializes every call on the list
+
+// Insert the key unless it is already in the list
+static void set_insert(list_t* p_list, data_t key)
+{
+    pthread_mutex_lock(&list_mutex);
+    if (!search_data(p_list, key))
+        insert_end(p_list, key);
+    pthread_mutex_unlock(&list_mutex);
+}
+
+// Remove the key if it is in the list
+static void set_remove(list_t* p_list, data_t key)
+{
+    pthread_mutex_lock(&list_mutex);
+    remove_data(p_list, key);
+    pthread_mutex_unlock(&list_mutex);
+}
+
+// Check if the key is in the list
+static int set_search(list_t* p_list, data_t key)
+{
+    int found = 0;
+    pthread_mutex_lock(&list_mutex);
+    found = search_data(p_list, key);
+    pthread_mutex_unlock(&list_mutex);
+    return (found);
+}
+#else
+// Insert the key unless it is already in the list
+static void set_insert(list_t* p_list, data_t key)
+{
+    insert(p_list, key);
+}
+
+// Remove the key if it is in the list
+static void set_remove(list_t* p_list, data_t key)
+{
+    remove_data(p_list, key);
+}
+
+// Check if the key is in the list
+static int set_search(list_t* p_list, data_t key)
+{
+    return (search_data(p_list, key));
+}
+#endif
+
+int main(int argc, char** argv)
+{
+    const char* format = "csv";
+    int max_threads = 8;
+    int nr_keys = 1024;
+    long nr_ops = 2000000L;
+    int update_percent = 20;
+    int header = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+            format = argv[++i];
+        else if (strcmp(argv[i], "--max-threads") == 0 && i + 1 < argc)
+            max_threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--keys") == 0 && i + 1 < argc)
+            nr_keys = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ops") == 0 && i + 1 < argc)
+            nr_ops = atol(argv[++i]);
+        else if (strcmp(argv[i], "--update-percent") == 0 && i + 1 < argc)
+            update_percent = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--no-header") == 0)
+            header = 0;
+        else
+        {
+            fprintf(stderr, "Usage : %s [--format csv|json] [--max-threads N] [--keys N] [--ops N] "
+                    "[--update-percent P] [--no-header]\n", argv[0]);
+            return (EXIT_FAILURE);
+        }
+    }
+    if (nr_keys < 1 || max_threads < 1 || update_percent < 0 || update_percent > 100)
+    {
+        fprintf(stderr, "%s: invalid arguments\n", argv[0]);
+        return (EXIT_FAILURE);
+    }
+
+    if (header && strcmp(format, "csv") == 0)
+        puts("variant,threads,keys,update_percent,ops,ns_per_op,ops_per_sec");
+
+    for (int nr_threads = 1; nr_threads <= max_threads; nr_threads = nr_threads * 2)
+        run_threads(nr_threads, nr_ops, nr_keys, update_percent, format);
+    return (EXIT_SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Get a monotonic time stamp in nanoseconds
+static long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((long long) ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+// Xorshift generator, private to every thread
+static unsigned int next_random(unsigned int* p_seed)
+{
+    unsigned int x = *p_seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *p_seed = x;
+    return (x);
+}
+
+// Run the operations of one thread once every thread is started
+static void* bench_worker(void* p_arg)
+{
+    bench_thread_t* p_thread = (bench_thread_t*) p_arg;
+    unsigned int r = 0;
+    data_t key = 0;
+    int found = 0;
+
+    pthread_barrier_wait(p_thread->p_barrier);
+    for (long i = 0; i < p_thread->nr_ops; ++i)
+    {
+        r = next_random(&p_thread->seed);
+        key = (data_t) ((r >> 8) % (unsigned int) p_thread->nr_keys);
+        if ((int) (r % 100) < p_thread->update_percent / 2)
+            set_insert(p_thread->p_list, key);
+        else if ((int) (r % 100) < p_thread->update_percent)
+            set_remove(p_thread->p_list, key);
+        else
+            found += set_search(p_thread->p_list, key);
+    }
+    return ((void*) (long) found);
+}
+
+// Share one list between nr_threads threads and print the throughput
+static void run_threads(int nr_threads, long nr_ops, int nr_keys, int update_percent, const char* format)
+{
+    bench_thread_t* p_threads = NULL;
+    pthread_t* p_ids = NULL;
+    pthread_barrier_t barrier;
+    list_t* p_list = NULL;
+    long long start = 0;
+    long long total_ns = 0;
+    long total_ops = 0;
+    double ns_per_op = 0.0;
+    double ops_per_sec = 0.0;
+
+    p_list = create_list();
+    for (data_t key = 0; key < nr_keys; key += 2)
+        set_insert(p_list, key);
+
+    p_threads = (bench_thread_t*) xcalloc(nr_threads, sizeof(bench_thread_t));
+    p_ids = (pthread_t*) xcalloc(nr_threads, sizeof(pthread_t));
+    pthread_barrier_init(&barrier, NULL, nr_threads + 1);
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        p_threads[i].p_list = p_list;
+        p_threads[i].nr_ops = nr_ops / nr_threads;
+        p_threads[i].nr_keys = nr_keys;
+        p_threads[i].update_percent = update_percent;
+        p_threads[i].seed = 2463534242u + 7919u * i;
+        p_threads[i].p_barrier = &barrier;
+        total_ops = total_ops + p_threads[i].nr_ops;
+        if (pthread_create(&p_ids[i], NULL, bench_worker, &p_threads[i]) != 0)
+        {
+            perror("pthread_create");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    pthread_barrier_wait(&barrier);
+    start = now_ns();
+    for (int i = 0; i < nr_threads; ++i)
+        pthread_join(p_ids[i], NULL);
+    total_ns = now_ns() - start;
+
+    pthread_barrier_destroy(&barrier);
+    free(p_ids);
+    free(p_threads);
+    destroy_list(&p_list);
+#ifndef BENCH_MUTEX
+    epoch_drain();
+#endif
+
+    if (total_ops > 0)
+        ns_per_op = (double) total_ns / total_ops;
+    if (total_ns > 0)
+        ops_per_sec = total_ops * 1e9 / total_ns;
+
+    if (strcmp(format, "json") == 0)
+        printf("{\"variant\": \"%s\", \"threads\": %d, \"keys\": %d, \"update_percent\": %d, \"ops\": %ld, "
+               "\"ns_per_op\": %.2f, \"ops_per_sec\": %.2f}\n",
+               LIST_VARIANT, nr_threads, nr_keys, update_percent, total_ops, ns_per_op, ops_per_sec);
+    else
+        printf("%s,%d,%d,%d,%ld,%.2f,%.2f\n",
+               LIST_VARIANT, nr_threads, nr_keys, update_percent, total_ops, ns_per_op, ops_per_sec);
+}
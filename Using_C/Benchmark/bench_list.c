@@ -0,0 +1,768 @@
+/**
+ * @file bench_list.c
+ * @author Akash_Thorat
+ * @brief A program to measure the operations of the linked list implementations.
+ * @version 0.1
+ * @date 2024-04-26
+ *
+ * This program times the operations which every "list.h" variant provides
+ * (inserts, getting, popping and removing at either end, removing, searching,
+ * size, sorting, adding, concating, reversing and merging) on lists of 1e2 up to
+ * 1e7 elements. Variants built with BENCH_KEYED also time radix_sort() and
+ * merge_k_sorted(), and the hash index on a list holding every element
+ * BENCH_DUP_COUNT times: index_insert_dup inserts an element which is already
+ * in the list after another one, index_remove_dup removes the first occurrence
+ * of an element. Variants built with BENCH_RING also time rotate(). The
+ * cursor, keyed and bulk removal routines are not timed here. parallel_sort() is
+ * timed with 2, 4 and 8 threads, to be compared against sort(). Variants built
+ * with BENCH_FRAGMENT, whose sort() relinks the nodes, also time search_data() on
+ * a list fragmented by sorting random elements, once as it is and once after
+ * compact_list(). The unrolled and the array backed lists sort by copying the
+ * elements, their nodes stay in order and are left out. The deque workloads keep
+ * a list of n elements while elements go in at one end and out at the other
+ * (deque_fifo), or in and out at random ends (deque_mixed), which shows the cost
+ * of pop_end() on the singly linked variants against the doubly linked ones.
+ * The same source is compiled once against every list variant (see the
+ * Makefile), LIST_VARIANT holding the name of the variant.
+ *
+ * Every measurement runs in a child process, so the peak resident set size which
+ * is reported belongs to that measurement only. Operations which walk the list are
+ * repeated until about BENCH_WORK elements have been visited, bulk operations such
+ * as sort() are repeated on fresh lists the same way. One record is printed per
+ * operation and size, either as CSV or as JSON lines, so that runs can be diffed.
+ *
+ * Usage : bench_list [--format csv|json] [--min-size N] [--max-size N]
+ *                    [--op NAME] [--no-header]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "list.h"
+
+#ifndef LIST_VARIANT
+#define LIST_VARIANT "list"
+#endif
+
+#define BENCH_WORK 10000000L         // Number of elements visited per measurement
+#define BENCH_MAX_REPEATS 100000L    // Upper limit for the repetitions of an operation
+#define BENCH_MERGE_K 8              // Number of lists merged by merge_k_sorted()
+#define BENCH_DUP_COUNT 8            // Number of occurrences of every element of the duplicate heavy lists
+
+// Define the result of one measurement
+typedef struct bench_result {
+    long nr_calls;           // Number of timed calls of the operation
+    long long total_ns;      // Time spent in the timed calls
+    long peak_rss_kb;        // Peak resident set size of the measurement
+} bench_result_t;
+
+typedef void (*bench_fn_t)(len_t n, bench_result_t* p_result);  // Typedef for a measurement routine
+
+// Define an operation of the benchmark
+typedef struct bench_op {
+    const char* name;        // Name of the operation
+    bench_fn_t fn;           // Routine measuring the operation
+} bench_op_t;
+
+static long long now_ns(void);
+static long nr_repeats(len_t n);
+static list_t* build_list(len_t n);
+static list_t* build_random_list(len_t n);
+#ifdef BENCH_FRAGMENT
+static void run_search_sorted_random(len_t n, bench_result_t* p_result, int compact);
+#endif
+static void run_op(const bench_op_t* p_op, len_t n, const char* format);
+static void run_parallel_sort(len_t n, bench_result_t* p_result, int nr_threads);
+
+//------------------------- measurement routines --------------------------
+
+// n calls of insert_start on a growing list
+static void bench_insert_start(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = create_list();
+    long long start = now_ns();
+    for (len_t i = 0; i < n; ++i)
+        insert_start(p_list, i);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = n;
+    destroy_list(&p_list);
+}
+
+// n calls of insert_end on a growing list
+static void bench_insert_end(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = create_list();
+    long long start = now_ns();
+    for (len_t i = 0; i < n; ++i)
+        insert_end(p_list, i);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = n;
+    destroy_list(&p_list);
+}
+
+// insert_after the element in the middle of the list
+static void bench_insert_after(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    long long start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        insert_after(p_list, n / 2, -1);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+
+// insert_before the element in the middle of the list
+static void bench_insert_before(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    long long start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        insert_before(p_list, n / 2, -1);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+
+// n calls of pop_start until the list is empty
+static void bench_pop_start(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    data_t data = 0;
+    long long start = now_ns();
+    for (len_t i = 0; i < n; ++i)
+        pop_start(p_list, &data);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = n;
+    destroy_list(&p_list);
+}
+
+// pop_end on a list of n elements
+static void bench_pop_end(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    data_t data = 0;
+    long long start = 0;
+
+    if (repeats > n)
+        repeats = n;
+    start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        pop_end(p_list, &data);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+
+// n calls of remove_start until the list is empty
+static void bench_remove_start(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long long start = now_ns();
+    for (len_t i = 0; i < n; ++i)
+        remove_start(p_list);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = n;
+    destroy_list(&p_list);
+}
+
+// remove_end on a list of n elements
+static void bench_remove_end(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    long long start = 0;
+
+    if (repeats > n)
+        repeats = n;
+    start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        remove_end(p_list);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+
+// get_start on a list of n elements
+static void bench_get_start(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    volatile data_t sum = 0;
+    data_t data = 0;
+    long long start = now_ns();
+    for (long i = 0; i < BENCH_MAX_REPEATS; ++i)
+    {
+        get_start(p_list, &data);
+        sum = sum + data;
+    }
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = BENCH_MAX_REPEATS;
+    destroy_list(&p_list);
+}
+
+// get_end on a list of n elements
+static void bench_get_end(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    volatile data_t sum = 0;
+    data_t data = 0;
+    long long start = now_ns();
+    for (long i = 0; i < BENCH_MAX_REPEATS; ++i)
+    {
+        get_end(p_list, &data);
+        sum = sum + data;
+    }
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = BENCH_MAX_REPEATS;
+    destroy_list(&p_list);
+}
+
+// size of a list of n elements
+static void bench_size(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    volatile len_t sum = 0;
+    long long start = now_ns();
+    for (long i = 0; i < BENCH_MAX_REPEATS; ++i)
+        sum = sum + size(p_list);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = BENCH_MAX_REPEATS;
+    destroy_list(&p_list);
+}
+
+// remove_data of distinct elements from the middle of the list
+static void bench_remove_data(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    long long start = 0;
+
+    if (repeats > n / 2)
+        repeats = n / 2;
+    start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        remove_data(p_list, n / 2 + i);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+
+// search_data of an element which is not in the list
+static void bench_search_data(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    volatile int found = 0;
+    long long start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        found = found + search_data(p_list, -1);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+
+#ifdef BENCH_FRAGMENT
+// search_data on a list whose nodes were scattered by sorting random elements
+static void bench_search_fragmented(len_t n, bench_result_t* p_result)
+{
+    run_search_sorted_random(n, p_result, 0);
+}
+
+// search_data on the same list once compact_list moved its nodes in traversal order
+static void bench_search_compacted(len_t n, bench_result_t* p_result)
+{
+    run_search_sorted_random(n, p_result, 1);
+}
+#endif
+
+// sort of a list of n random elements
+static void bench_sort(len_t n, bench_result_t* p_result)
+{
+    long repeats = nr_repeats(n);
+    list_t* p_list = NULL;
+    long long start = 0;
+
+    for (long i = 0; i < repeats; ++i)
+    {
+        p_list = build_random_list(n);
+        start = now_ns();
+        sort(p_list);
+        p_result->total_ns = p_result->total_ns + now_ns() - start;
+        destroy_list(&p_list);
+    }
+    p_result->nr_calls = repeats;
+}
+
+#ifdef BENCH_KEYED
+// radix_sort of a list of n random elements
+static void bench_radix_sort(len_t n, bench_result_t* p_result)
+{
+    long repeats = nr_repeats(n);
+    list_t* p_list = NULL;
+    long long start = 0;
+
+    for (long i = 0; i < repeats; ++i)
+    {
+        p_list = build_random_list(n);
+        start = now_ns();
+        radix_sort(p_list);
+        p_result->total_ns = p_result->total_ns + now_ns() - start;
+        destroy_list(&p_list);
+    }
+    p_result->nr_calls = repeats;
+}
+#endif
+
+// parallel_sort on fresh random lists, with 2, 4 and 8 threads
+static void bench_parallel_sort_2(len_t n, bench_result_t* p_result)
+{
+    run_parallel_sort(n, p_result, 2);
+}
+
+static void bench_parallel_sort_4(len_t n, bench_result_t* p_result)
+{
+    run_parallel_sort(n, p_result, 4);
+}
+
+static void bench_parallel_sort_8(len_t n, bench_result_t* p_result)
+{
+    run_parallel_sort(n, p_result, 8);
+}
+
+// add_lists of two lists of n / 2 elements
+static void bench_add_lists(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list_1 = build_list(n / 2);
+    list_t* p_list_2 = build_list(n - n / 2);
+    list_t* p_new_list = NULL;
+    long repeats = nr_repeats(n);
+    long long start = 0;
+
+    for (long i = 0; i < repeats; ++i)
+    {
+        start = now_ns();
+        p_new_list = add_lists(p_list_1, p_list_2);
+        p_result->total_ns = p_result->total_ns + now_ns() - start;
+        destroy_list(&p_new_list);
+    }
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list_1);
+    destroy_list(&p_list_2);
+}
+
+// concat_lists of two lists of n / 2 elements
+static void bench_concat_lists(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list_1 = NULL;
+    list_t* p_list_2 = NULL;
+    long repeats = nr_repeats(n);
+    long long start = 0;
+
+    for (long i = 0; i < repeats; ++i)
+    {
+        p_list_1 = build_list(n / 2);
+        p_list_2 = build_list(n - n / 2);
+        start = now_ns();
+        concat_lists(p_list_1, p_list_2);
+        p_result->total_ns = p_result->total_ns + now_ns() - start;
+        destroy_list(&p_list_1);
+        destroy_list(&p_list_2);
+    }
+    p_result->nr_calls = repeats;
+}
+
+// reverse_list of a list of n elements
+static void bench_reverse_list(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    long long start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        reverse_list(p_list);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+
+// get_merged_list of two random lists of n / 2 elements
+static void bench_get_merged_list(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list_1 = build_random_list(n / 2);
+    list_t* p_list_2 = build_random_list(n - n / 2);
+    list_t* p_new_list = NULL;
+    long repeats = nr_repeats(n);
+    long long start = 0;
+
+    for (long i = 0; i < repeats; ++i)
+    {
+        start = now_ns();
+        p_new_list = get_merged_list(p_list_1, p_list_2);
+        p_result->total_ns = p_result->total_ns + now_ns() - start;
+        destroy_list(&p_new_list);
+    }
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list_1);
+    destroy_list(&p_list_2);
+}
+
+#ifdef BENCH_KEYED
+// merge_k_sorted of BENCH_MERGE_K sorted lists of n / BENCH_MERGE_K interleaved elements
+static void bench_merge_k_sorted(len_t n, bench_result_t* p_result)
+{
+    list_t* p_lists[BENCH_MERGE_K];
+    list_t* p_new_list = NULL;
+    long repeats = nr_repeats(n);
+    long long start = 0;
+
+    for (long i = 0; i < repeats; ++i)
+    {
+        for (int j = 0; j < BENCH_MERGE_K; ++j)
+            p_lists[j] = create_list();
+        for (len_t e = 0; e < n; ++e)
+            insert_end(p_lists[e % BENCH_MERGE_K], e);
+
+        start = now_ns();
+        p_new_list = merge_k_sorted(p_lists, BENCH_MERGE_K);
+        p_result->total_ns = p_result->total_ns + now_ns() - start;
+
+        destroy_list(&p_new_list);
+        for (int j = 0; j < BENCH_MERGE_K; ++j)
+            destroy_list(&p_lists[j]);
+    }
+    p_result->nr_calls = repeats;
+}
+#endif
+
+#ifdef BENCH_KEYED
+// insert_after with the hash index, the inserted element already occurs BENCH_DUP_COUNT times
+static void bench_index_insert_dup(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = create_list();
+    len_t nr_keys = n / BENCH_DUP_COUNT + 1;
+    long long start = 0;
+
+    for (len_t i = 0; i < n; ++i)
+        insert_end(p_list, i % nr_keys);
+    enable_index(p_list);
+
+    start = now_ns();
+    for (long i = 0; i < BENCH_MAX_REPEATS; ++i)
+        insert_after(p_list, (i * 7919) % nr_keys, i % nr_keys);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = BENCH_MAX_REPEATS;
+    destroy_list(&p_list);
+}
+
+// remove_data with the hash index, the next occurrence of the removed element becomes the first one
+static void bench_index_remove_dup(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = create_list();
+    len_t nr_keys = n / BENCH_DUP_COUNT + 1;
+    long repeats = nr_repeats(n);
+    long long start = 0;
+
+    for (len_t i = 0; i < n; ++i)
+        insert_end(p_list, i % nr_keys);
+    enable_index(p_list);
+
+    if (repeats > n / 2)
+        repeats = n / 2;
+    start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        remove_data(p_list, i % nr_keys);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+#endif
+
+#ifdef BENCH_RING
+// rotate a list of n elements by half its length
+static void bench_rotate(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    long long start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        rotate(p_list, n / 2);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+#endif
+
+// insert_start then pop_end on a list of n elements, the list is used as a queue
+static void bench_deque_fifo(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    data_t data = 0;
+    long long start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+    {
+        insert_start(p_list, i);
+        pop_end(p_list, &data);
+    }
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = 2 * repeats;
+    destroy_list(&p_list);
+}
+
+// An insert and a pop at random ends on a list of n elements, the list is used as a deque
+static void bench_deque_mixed(len_t n, bench_result_t* p_result)
+{
+    list_t* p_list = build_list(n);
+    long repeats = nr_repeats(n);
+    char* p_ends = NULL;
+    data_t data = 0;
+    long long start = 0;
+
+    // The ends are drawn before timing, two bits per repetition
+    p_ends = (char*) malloc(repeats);
+    for (long i = 0; i < repeats; ++i)
+        p_ends[i] = (char) (rand() & 3);
+
+    start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+    {
+        if (p_ends[i] & 1)
+            insert_end(p_list, i);
+        else
+            insert_start(p_list, i);
+        if (p_ends[i] & 2)
+            pop_end(p_list, &data);
+        else
+            pop_start(p_list, &data);
+    }
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = 2 * repeats;
+    free(p_ends);
+    destroy_list(&p_list);
+}
+
+static const bench_op_t bench_ops[] = {
+    {"insert_start", bench_insert_start},
+    {"insert_end", bench_insert_end},
+    {"insert_after", bench_insert_after},
+    {"insert_before", bench_insert_before},
+    {"pop_start", bench_pop_start},
+    {"pop_end", bench_pop_end},
+    {"remove_start", bench_remove_start},
+    {"remove_end", bench_remove_end},
+    {"get_start", bench_get_start},
+    {"get_end", bench_get_end},
+    {"size", bench_size},
+    {"deque_fifo", bench_deque_fifo},
+    {"deque_mixed", bench_deque_mixed},
+    {"remove_data", bench_remove_data},
+    {"search_data", bench_search_data},
+#ifdef BENCH_FRAGMENT
+    {"search_fragmented", bench_search_fragmented},
+    {"search_compacted", bench_search_compacted},
+#endif
+    {"sort", bench_sort},
+    {"parallel_sort_2", bench_parallel_sort_2},
+    {"parallel_sort_4", bench_parallel_sort_4},
+    {"parallel_sort_8", bench_parallel_sort_8},
+#ifdef BENCH_KEYED
+    {"radix_sort", bench_radix_sort},
+    {"merge_k_sorted", bench_merge_k_sorted},
+    {"index_insert_dup", bench_index_insert_dup},
+    {"index_remove_dup", bench_index_remove_dup},
+#endif
+    {"add_lists", bench_add_lists},
+    {"concat_lists", bench_concat_lists},
+    {"reverse_list", bench_reverse_list},
+    {"get_merged_list", bench_get_merged_list},
+#ifdef BENCH_RING
+    {"rotate", bench_rotate},
+#endif
+};
+
+int main(int argc, char** argv)
+{
+    const char* format = "csv";
+    const char* op_name = NULL;
+    len_t min_size = 100;
+    len_t max_size = 10000000;
+    int header = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+            format = argv[++i];
+        else if (strcmp(argv[i], "--min-size") == 0 && i + 1 < argc)
+            min_size = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc)
+            max_size = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--op") == 0 && i + 1 < argc)
+            op_name = argv[++i];
+        else if (strcmp(argv[i], "--no-header") == 0)
+            header = 0;
+        else
+        {
+            fprintf(stderr, "Usage : %s [--format csv|json] [--min-size N] [--max-size N] [--op NAME] [--no-header]\n", argv[0]);
+            return (EXIT_FAILURE);
+        }
+    }
+
+    if (header && strcmp(format, "csv") == 0)
+        puts("variant,operation,size,calls,ns_per_call,calls_per_sec,peak_rss_kb");
+
+    for (len_t n = min_size; n <= max_size; n = n * 10)
+    {
+        for (size_t i = 0; i < sizeof(bench_ops) / sizeof(bench_ops[0]); ++i)
+        {
+            if (op_name == NULL || strcmp(op_name, bench_ops[i].name) == 0)
+                run_op(&bench_ops[i], n, format);
+        }
+        if (n > max_size / 10)
+            break;
+    }
+    return (EXIT_SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Get a monotonic time stamp in nanoseconds
+static long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((long long) ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+// Get the number of repetitions of an operation visiting n elements
+static long nr_repeats(len_t n)
+{
+    long repeats = BENCH_WORK / (n > 0 ? n : 1);
+    if (repeats < 1)
+        repeats = 1;
+    if (repeats > BENCH_MAX_REPEATS)
+        repeats = BENCH_MAX_REPEATS;
+    return (repeats);
+}
+
+// Build a list holding 0 ... n - 1
+static list_t* build_list(len_t n)
+{
+    list_t* p_list = create_list();
+    for (len_t i = 0; i < n; ++i)
+        insert_end(p_list, i);
+    return (p_list);
+}
+
+// Build a list holding n random elements
+static list_t* build_random_list(len_t n)
+{
+    list_t* p_list = create_list();
+    for (len_t i = 0; i < n; ++i)
+        insert_end(p_list, rand());
+    return (p_list);
+}
+
+#ifdef BENCH_FRAGMENT
+// Time search_data for a missing element on sorted random elements, after compact_list if compact is set
+static void run_search_sorted_random(len_t n, bench_result_t* p_result, int compact)
+{
+    list_t* p_list = build_random_list(n);
+    long repeats = nr_repeats(n);
+    volatile int found = 0;
+    long long start = 0;
+
+    sort(p_list);
+    if (compact)
+        compact_list(p_list);
+    start = now_ns();
+    for (long i = 0; i < repeats; ++i)
+        found = found + search_data(p_list, -1);
+    p_result->total_ns = now_ns() - start;
+    p_result->nr_calls = repeats;
+    destroy_list(&p_list);
+}
+#endif
+
+// Time parallel_sort with nr_threads threads on fresh random lists
+static void run_parallel_sort(len_t n, bench_result_t* p_result, int nr_threads)
+{
+    long repeats = nr_repeats(n);
+    list_t* p_list = NULL;
+    long long start = 0;
+
+    for (long i = 0; i < repeats; ++i)
+    {
+        p_list = build_random_list(n);
+        start = now_ns();
+        parallel_sort(p_list, nr_threads);
+        p_result->total_ns = p_result->total_ns + now_ns() - start;
+        destroy_list(&p_list);
+    }
+    p_result->nr_calls = repeats;
+}
+
+// Run one measurement in a child process and print its record
+static void run_op(const bench_op_t* p_op, len_t n, const char* format)
+{
+    bench_result_t result = {0, 0, 0};
+    struct rusage usage;
+    int fds[2];
+    pid_t pid = 0;
+    double ns_per_call = 0.0;
+    double calls_per_sec = 0.0;
+
+    fflush(stdout);
+    if (pipe(fds) != 0)
+    {
+        perror("pipe");
+        exit(EXIT_FAILURE);
+    }
+
+    pid = fork();
+    if (pid < 0)
+    {
+        perror("fork");
+        exit(EXIT_FAILURE);
+    }
+    if (pid == 0)
+    {
+        close(fds[0]);
+        srand(1);
+        p_op->fn(n, &result);
+        getrusage(RUSAGE_SELF, &usage);
+        result.peak_rss_kb = usage.ru_maxrss;
+        if (write(fds[1], &result, sizeof(result)) != sizeof(result))
+            _exit(EXIT_FAILURE);
+        _exit(EXIT_SUCCESS);
+    }
+
+    close(fds[1]);
+    if (read(fds[0], &result, sizeof(result)) != sizeof(result))
+    {
+        fprintf(stderr, "%s: measurement of %s failed for size %d\n", LIST_VARIANT, p_op->name, n);
+        close(fds[0]);
+        waitpid(pid, NULL, 0);
+        return;
+    }
+    close(fds[0]);
+    waitpid(pid, NULL, 0);
+
+    if (result.nr_calls > 0)
+        ns_per_call = (double) result.total_ns / result.nr_calls;
+    if (result.total_ns > 0)
+        calls_per_sec = result.nr_calls * 1e9 / result.total_ns;
+
+    if (strcmp(format, "json") == 0)
+        printf("{\"variant\": \"%s\", \"operation\": \"%s\", \"size\": %d, \"calls\": %ld, "
+               "\"ns_per_call\": %.2f, \"calls_per_sec\": %.2f, \"peak_rss_kb\": %ld}\n",
+               LIST_VARIANT, p_op->name, n, result.nr_calls, ns_per_call, calls_per_sec, result.peak_rss_kb);
+    else
+        printf("%s,%s,%d,%ld,%.2f,%.2f,%ld\n",
+               LIST_VARIANT, p_op->name, n, result.nr_calls, ns_per_call, calls_per_sec, result.peak_rss_kb);
+}
@@ -0,0 +1,289 @@
+/**
+ * @file bench_queue.c
+ * @author Akash_Thorat
+ * @brief A program to measure a list used as a work queue by producers and consumers.
+ * @version 0.1
+ * @date 2024-05-09
+ *
+ * This program passes values from producer threads to consumer threads through
+ * one shared queue, with 1, 2, 4, ... up to 64 threads, and reports the total
+ * throughput. The same source is compiled against the lock free queue and, with
+ * BENCH_MUTEX defined, against the singly linked list used through insert_end()
+ * and pop_start() behind one global mutex (see the Makefile), LIST_VARIANT holding
+ * the name of the variant.
+ *
+ * Half of the threads produce and half consume, a single thread enqueues and
+ * dequeues in turn. Every value is checked to be dequeued exactly once by
+ * comparing the sums of the enqueued and dequeued values. One record is printed
+ * per number of threads, either as CSV or as JSON lines.
+ *
+ * Usage : bench_queue [--format csv|json] [--max-threads N] [--ops N] [--no-header]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "list.h"
+#ifndef BENCH_MUTEX
+#include "queue.h"
+#endif
+
+#ifndef LIST_VARIANT
+#define LIST_VARIANT "list"
+#endif
+
+#ifdef BENCH_MUTEX
+typedef list_t bench_queue_t;    // Queue is a list used through insert_end() and pop_start()
+#else
+typedef queue_t bench_queue_t;   // Queue is the lock free queue
+#endif
+
+// Define the work of one thread
+typedef struct bench_thread {
+    bench_queue_t* p_queue;      // Queue shared by the threads
+    long nr_values;              // Number of values enqueued by a producer
+    atomic_long* p_remaining;    // Number of values not yet dequeued by any consumer
+    long sum;                    // Sum of the values enqueued or dequeued by the thread
+    pthread_barrier_t* p_barrier; // Start of the measurement
+} bench_thread_t;
+
+static long long now_ns(void);
+static void* bench_producer(void* p_arg);
+static void* bench_consumer(void* p_arg);
+static void* bench_single(void* p_arg);
+static void run_threads(int nr_threads, long nr_ops, const char* format);
+
+//------------------------- operations of the queue -----------------------
+
+#ifdef BENCH_MUTEX
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;  // Serializes every call on the list
+
+// Create the queue
+static bench_queue_t* queue_create(void)
+{
+    return (create_list());
+}
+
+// Add data at the end of the queue
+static void queue_put(bench_queue_t* p_queue, data_t data)
+{
+    pthread_mutex_lock(&queue_mutex);
+    insert_end(p_queue, data);
+    pthread_mutex_unlock(&queue_mutex);
+}
+
+// Remove the first element, LIST_EMPTY if there is none
+static status_t queue_take(bench_queue_t* p_queue, data_t* p_data)
+{
+    status_t status = SUCCESS;
+    pthread_mutex_lock(&queue_mutex);
+    status = pop_start(p_queue, p_data);
+    pthread_mutex_unlock(&queue_mutex);
+    return (status);
+}
+
+// Destroy the queue
+static void queue_destroy(bench_queue_t** pp_queue)
+{
+    destroy_list(pp_queue);
+}
+#else
+// Create the queue
+static bench_queue_t* queue_create(void)
+{
+    return (create_queue());
+}
+
+// Add data at the end of the queue
+static void queue_put(bench_queue_t* p_queue, data_t data)
+{
+    enqueue(p_queue, data);
+}
+
+// Remove the first element, LIST_EMPTY if there is none
+static status_t queue_take(bench_queue_t* p_queue, data_t* p_data)
+{
+    return (try_dequeue(p_queue, p_data));
+}
+
+// Destroy the queue
+static void queue_destroy(bench_queue_t** pp_queue)
+{
+    destroy_queue(pp_queue);
+}
+#endif
+
+int main(int argc, char** argv)
+{
+    const char* format = "csv";
+    int max_threads = 64;
+    long nr_ops = 2000000L;
+    int header = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+            format = argv[++i];
+        else if (strcmp(argv[i], "--max-threads") == 0 && i + 1 < argc)
+            max_threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ops") == 0 && i + 1 < argc)
+            nr_ops = atol(argv[++i]);
+        else if (strcmp(argv[i], "--no-header") == 0)
+            header = 0;
+        else
+        {
+            fprintf(stderr, "Usage : %s [--format csv|json] [--max-threads N] [--ops N] [--no-header]\n", argv[0]);
+            return (EXIT_FAILURE);
+        }
+    }
+    if (max_threads < 1 || nr_ops < 1)
+    {
+        fprintf(stderr, "%s: invalid arguments\n", argv[0]);
+        return (EXIT_FAILURE);
+    }
+
+    if (header && strcmp(format, "csv") == 0)
+        puts("variant,threads,producers,consumers,values,ns_per_value,values_per_sec");
+
+    for (int nr_threads = 1; nr_threads <= max_threads; nr_threads = nr_threads * 2)
+        run_threads(nr_threads, nr_ops, format);
+    return (EXIT_SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Get a monotonic time stamp in nanoseconds
+static long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((long long) ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+// Enqueue the values of one producer
+static void* bench_producer(void* p_arg)
+{
+    bench_thread_t* p_thread = (bench_thread_t*) p_arg;
+
+    pthread_barrier_wait(p_thread->p_barrier);
+    for (long i = 0; i < p_thread->nr_values; ++i)
+    {
+        queue_put(p_thread->p_queue, (data_t) i);
+        p_thread->sum = p_thread->sum + i;
+    }
+    return (NULL);
+}
+
+// Dequeue values until every value of every producer was dequeued
+static void* bench_consumer(void* p_arg)
+{
+    bench_thread_t* p_thread = (bench_thread_t*) p_arg;
+    data_t data = 0;
+
+    pthread_barrier_wait(p_thread->p_barrier);
+    while (atomic_load(p_thread->p_remaining) > 0)
+    {
+        if (queue_take(p_thread->p_queue, &data) == SUCCESS)
+        {
+            p_thread->sum = p_thread->sum + data;
+            atomic_fetch_sub(p_thread->p_remaining, 1);
+        }
+        else
+            sched_yield();
+    }
+    return (NULL);
+}
+
+// Enqueue and dequeue in turn from a single thread
+static void* bench_single(void* p_arg)
+{
+    bench_thread_t* p_thread = (bench_thread_t*) p_arg;
+    data_t data = 0;
+
+    pthread_barrier_wait(p_thread->p_barrier);
+    for (long i = 0; i < p_thread->nr_values; ++i)
+    {
+        queue_put(p_thread->p_queue, (data_t) i);
+        queue_take(p_thread->p_queue, &data);
+        p_thread->sum = p_thread->sum + i - data;
+    }
+    atomic_store(p_thread->p_remaining, 0);
+    return (NULL);
+}
+
+// Pass nr_ops values through one queue shared by nr_threads threads and print the throughput
+static void run_threads(int nr_threads, long nr_ops, const char* format)
+{
+    bench_thread_t* p_threads = NULL;
+    pthread_t* p_ids = NULL;
+    pthread_barrier_t barrier;
+    bench_queue_t* p_queue = NULL;
+    atomic_long remaining;
+    int nr_producers = 0;
+    int nr_consumers = 0;
+    long long start = 0;
+    long long total_ns = 0;
+    long total_values = 0;
+    long sum = 0;
+    double ns_per_value = 0.0;
+    double values_per_sec = 0.0;
+
+    nr_producers = (nr_threads == 1) ? 1 : nr_threads / 2;
+    nr_consumers = (nr_threads == 1) ? 1 : nr_threads - nr_producers;
+    total_values = (nr_ops / nr_producers) * nr_producers;
+    atomic_init(&remaining, total_values);
+
+    p_queue = queue_create();
+    p_threads = (bench_thread_t*) xcalloc(nr_threads, sizeof(bench_thread_t));
+    p_ids = (pthread_t*) xcalloc(nr_threads, sizeof(pthread_t));
+    pthread_barrier_init(&barrier, NULL, nr_threads + 1);
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        p_threads[i].p_queue = p_queue;
+        p_threads[i].nr_values = nr_ops / nr_producers;
+        p_threads[i].p_remaining = &remaining;
+        p_threads[i].sum = 0;
+        p_threads[i].p_barrier = &barrier;
+        if (pthread_create(&p_ids[i], NULL,
+                           (nr_threads == 1) ? bench_single : (i < nr_producers) ? bench_producer : bench_consumer,
+                           &p_threads[i]) != 0)
+        {
+            perror("pthread_create");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    pthread_barrier_wait(&barrier);
+    start = now_ns();
+    for (int i = 0; i < nr_threads; ++i)
+        pthread_join(p_ids[i], NULL);
+    total_ns = now_ns() - start;
+
+    // Producers add what they enqueued, consumers take off what they dequeued
+    for (int i = 0; i < nr_threads; ++i)
+        sum = sum + ((i < nr_producers) ? p_threads[i].sum : -p_threads[i].sum);
+    if (sum != 0)
+        fprintf(stderr, "%s: values lost or duplicated with %d threads\n", LIST_VARIANT, nr_threads);
+
+    pthread_barrier_destroy(&barrier);
+    free(p_ids);
+    free(p_threads);
+    queue_destroy(&p_queue);
+
+    if (total_values > 0)
+        ns_per_value = (double) total_ns / total_values;
+    if (total_ns > 0)
+        values_per_sec = total_values * 1e9 / total_ns;
+
+    if (strcmp(format, "json") == 0)
+        printf("{\"variant\": \"%s\", \"threads\": %d, \"producers\": %d, \"consumers\": %d, \"values\": %ld, "
+               "\"ns_per_value\": %.2f, \"values_per_sec\": %.2f}\n",
+               LIST_VARIANT, nr_threads, nr_producers, nr_consumers, total_values, ns_per_value, values_per_sec);
+    else
+        printf("%s,%d,%d,%d,%ld,%.2f,%.2f\n",
+               LIST_VARIANT, nr_threads, nr_producers, nr_consumers, total_values, ns_per_value, values_per_sec);
+}
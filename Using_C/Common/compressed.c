@@ -0,0 +1,280 @@
+/**
+ * @file compressed.c
+ * @author Akash_Thorat
+ * @brief Implementation of a compressed read only copy of a sorted linked list.
+ * @version 0.1
+ * @date 2024-05-14
+ *
+ * This file contains the implementation of the compressed list. The difference
+ * between an element and the previous one is never negative since the elements
+ * are sorted, it is computed on unsigned integers so that it can not overflow,
+ * and written 7 bits per byte, the high bit of a byte telling that another byte
+ * follows. The first element of every block is kept in its header instead, so a
+ * block can be decoded without the blocks before it.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (compressed.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "compressed.h"
+
+// Compress a sorted list, NULL if an element is lower than the one before it
+clist_t* create_clist(list_t* p_list)
+{
+    clist_t* p_clist = NULL;
+    node_t* p_run = NULL;
+
+    p_clist = clist_new();
+    p_run = p_list->head.next;
+    for (len_t i = 0; i < size(p_list); ++i)
+    {
+        if (i > 0 && p_run->data < p_clist->last)
+        {
+            destroy_clist(&p_clist);
+            return (NULL);
+        }
+        clist_append(p_clist, p_run->data);
+        p_run = p_run->next;
+    }
+    clist_shrink(p_clist);
+
+    return (p_clist);
+}
+
+// Return new list holding the elements of the compressed list
+list_t* clist_to_list(clist_t* p_clist)
+{
+    list_t* p_list = NULL;
+    clist_iter_t iter;
+    data_t data = 0;
+
+    p_list = create_list();
+    clist_iter_init(&iter, p_clist);
+    while (clist_iter_next(&iter, &data))
+        insert_end(p_list, data);
+
+    return (p_list);
+}
+
+// Get the number of elements of the compressed list
+len_t clist_size(clist_t* p_clist)
+{
+    return (p_clist->nr_elements);
+}
+
+// Get the number of bytes used by the compressed list, headers included
+long clist_memory(clist_t* p_clist)
+{
+    return ((long) sizeof(clist_t) + (long) p_clist->max_blocks * sizeof(clist_block_t) + p_clist->max_bytes);
+}
+
+// Search for a specific value, the block which may hold it is found by a binary search and decoded alone
+int clist_search_data(clist_t* p_clist, data_t f_data)
+{
+    clist_block_t* p_block = NULL;
+    len_t low = 0;
+    len_t high = 0;
+    len_t middle = 0;
+    len_t offset = 0;
+    len_t nr_data = 0;
+    data_t data = 0;
+
+    if (p_clist->nr_blocks == 0 || f_data < p_clist->p_blocks[0].first)
+        return (0);
+
+    // Last block whose first element is not greater than f_data
+    low = 0;
+    high = p_clist->nr_blocks - 1;
+    while (low < high)
+    {
+        middle = low + (high - low + 1) / 2;
+        if (p_clist->p_blocks[middle].first <= f_data)
+            low = middle;
+        else
+            high = middle - 1;
+    }
+
+    p_block = &p_clist->p_blocks[low];
+    nr_data = (low == p_clist->nr_blocks - 1) ? p_clist->nr_elements - low * CLIST_BLOCK_ELEMENTS : CLIST_BLOCK_ELEMENTS;
+    data = p_block->first;
+    offset = p_block->offset;
+    for (len_t i = 1; i < nr_data && data < f_data; ++i)
+        data = (data_t) ((unsigned int) data + clist_get_varint(p_clist->p_bytes, &offset));
+
+    return (data == f_data);
+}
+
+// Start walking over the elements of the compressed list
+void clist_iter_init(clist_iter_t* p_iter, clist_t* p_clist)
+{
+    p_iter->p_clist = p_clist;
+    p_iter->position = 0;
+    p_iter->offset = 0;
+    p_iter->data = 0;
+}
+
+// Get the next element, returns 0 once every element was returned
+int clist_iter_next(clist_iter_t* p_iter, data_t* p_data)
+{
+    const clist_t* p_clist = p_iter->p_clist;
+    const clist_block_t* p_block = NULL;
+
+    if (p_iter->position == p_clist->nr_elements)
+        return (0);
+
+    if (p_iter->position % CLIST_BLOCK_ELEMENTS == 0)
+    {
+        p_block = &p_clist->p_blocks[p_iter->position / CLIST_BLOCK_ELEMENTS];
+        p_iter->data = p_block->first;
+        p_iter->offset = p_block->offset;
+    }
+    else
+        p_iter->data = (data_t) ((unsigned int) p_iter->data + clist_get_varint(p_clist->p_bytes, &p_iter->offset));
+
+    p_iter->position = p_iter->position + 1;
+    *p_data = p_iter->data;
+    return (1);
+}
+
+// Return new compressed list merging two compressed lists, both are decoded one element at a time
+clist_t* clist_merge(clist_t* p_clist_1, clist_t* p_clist_2)
+{
+    clist_t* p_merged = NULL;
+    clist_iter_t iter_1;
+    clist_iter_t iter_2;
+    data_t data_1 = 0;
+    data_t data_2 = 0;
+    int more_1 = 0;
+    int more_2 = 0;
+
+    p_merged = clist_new();
+    clist_iter_init(&iter_1, p_clist_1);
+    clist_iter_init(&iter_2, p_clist_2);
+    more_1 = clist_iter_next(&iter_1, &data_1);
+    more_2 = clist_iter_next(&iter_2, &data_2);
+
+    while (more_1 || more_2)
+    {
+        if (more_1 && (!more_2 || data_1 <= data_2))
+        {
+            clist_append(p_merged, data_1);
+            more_1 = clist_iter_next(&iter_1, &data_1);
+        }
+        else
+        {
+            clist_append(p_merged, data_2);
+            more_2 = clist_iter_next(&iter_2, &data_2);
+        }
+    }
+    clist_shrink(p_merged);
+
+    return (p_merged);
+}
+
+// Destroy the compressed list and free memory
+status_t destroy_clist(clist_t** pp_clist)
+{
+    free((*pp_clist)->p_blocks);
+    free((*pp_clist)->p_bytes);
+    free(*pp_clist);
+    *pp_clist = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Create an empty compressed list
+static clist_t* clist_new(void)
+{
+    clist_t* p_clist = NULL;
+
+    p_clist = (clist_t*) xcalloc(1, sizeof(clist_t));
+    p_clist->p_blocks = NULL;
+    p_clist->p_bytes = NULL;
+    return (p_clist);
+}
+
+// Append an element which is not lower than the last one, a new block is started every CLIST_BLOCK_ELEMENTS elements
+static void clist_append(clist_t* p_clist, data_t data)
+{
+    if (p_clist->nr_elements % CLIST_BLOCK_ELEMENTS == 0)
+    {
+        if (p_clist->nr_blocks == p_clist->max_blocks)
+        {
+            p_clist->max_blocks = (p_clist->max_blocks == 0) ? 16 : 2 * p_clist->max_blocks;
+            p_clist->p_blocks = (clist_block_t*) xrealloc(p_clist->p_blocks, (long) p_clist->max_blocks * sizeof(clist_block_t));
+        }
+        p_clist->p_blocks[p_clist->nr_blocks].first = data;
+        p_clist->p_blocks[p_clist->nr_blocks].offset = p_clist->nr_bytes;
+        p_clist->nr_blocks = p_clist->nr_blocks + 1;
+    }
+    else
+        clist_put_varint(p_clist, (unsigned int) data - (unsigned int) p_clist->last);
+
+    p_clist->last = data;
+    p_clist->nr_elements = p_clist->nr_elements + 1;
+}
+
+// Append value 7 bits per byte, lowest bits first, the high bit is set on every byte but the last
+static void clist_put_varint(clist_t* p_clist, unsigned int value)
+{
+    // An unsigned int takes at most 5 bytes
+    if (p_clist->nr_bytes + 5 > p_clist->max_bytes)
+    {
+        p_clist->max_bytes = (p_clist->max_bytes == 0) ? 256 : 2 * p_clist->max_bytes;
+        p_clist->p_bytes = (unsigned char*) xrealloc(p_clist->p_bytes, p_clist->max_bytes);
+    }
+
+    while (value >= 0x80)
+    {
+        p_clist->p_bytes[p_clist->nr_bytes++] = (unsigned char) (value | 0x80);
+        value = value >> 7;
+    }
+    p_clist->p_bytes[p_clist->nr_bytes++] = (unsigned char) value;
+}
+
+// Read the variable length integer at *p_offset and move *p_offset after it
+static unsigned int clist_get_varint(const unsigned char* p_bytes, len_t* p_offset)
+{
+    unsigned int value = 0;
+    int shift = 0;
+    unsigned char byte = 0;
+
+    do
+    {
+        byte = p_bytes[(*p_offset)++];
+        value = value | ((unsigned int) (byte & 0x7f) << shift);
+        shift = shift + 7;
+    } while (byte & 0x80);
+
+    return (value);
+}
+
+// Release the capacity left after the last block and the last byte
+static void clist_shrink(clist_t* p_clist)
+{
+    if (p_clist->nr_blocks > 0 && p_clist->nr_blocks < p_clist->max_blocks)
+    {
+        p_clist->p_blocks = (clist_block_t*) xrealloc(p_clist->p_blocks, (long) p_clist->nr_blocks * sizeof(clist_block_t));
+        p_clist->max_blocks = p_clist->nr_blocks;
+    }
+    if (p_clist->nr_bytes > 0 && p_clist->nr_bytes < p_clist->max_bytes)
+    {
+        p_clist->p_bytes = (unsigned char*) xrealloc(p_clist->p_bytes, p_clist->nr_bytes);
+        p_clist->max_bytes = p_clist->nr_bytes;
+    }
+}
+
+// Helper function to resize memory
+static void* xrealloc(void* p, long size)
+{
+    p = realloc(p, size);
+    if (p == NULL)
+    {
+        puts("ERROR while allocating memory ..!");
+        exit(EXIT_FAILURE);
+    }
+    return (p);
+}
@@ -0,0 +1,80 @@
+/**
+ * @file compressed.h
+ * @author Akash_Thorat
+ * @brief Header file defining a compressed read only copy of a sorted linked list.
+ * @version 0.1
+ * @date 2024-05-14
+ *
+ * This header file contains the declarations for a compressed list which holds
+ * the elements of a sorted list as the differences between neighbours, every
+ * difference being written as a variable length integer of 7 bits per byte. Close
+ * elements, such as sorted identifiers, take one or two bytes each instead of a
+ * whole node.
+ *
+ * The elements are cut into blocks of CLIST_BLOCK_ELEMENTS. Every block has a
+ * header holding its first element and the position of its bytes, so a search
+ * picks the block with a binary search over the headers and decodes only that
+ * block. Iteration and merging decode the elements one by one, a compressed list
+ * is never expanded as a whole.
+ *
+ * The compressed list only goes through the interface of list.h, it is shared
+ * by the singly variants and compiled against the list.h of each of them.
+ */
+
+#ifndef _COMPRESSED_H
+#define _COMPRESSED_H
+
+#include "list.h"
+
+#define CLIST_BLOCK_ELEMENTS 128     // Number of elements of a block
+
+// Define the header of a block
+struct clist_block {
+    data_t first;            // First element of the block, stored in full
+    len_t offset;            // Position in p_bytes of the differences of the following elements
+};
+
+// Define the structure of the compressed list
+struct clist {
+    struct clist_block* p_blocks;    // Headers of the blocks
+    len_t nr_blocks;                 // Number of blocks
+    len_t max_blocks;                // Number of allocated headers
+    unsigned char* p_bytes;          // Differences between neighbours, as variable length integers
+    len_t nr_bytes;                  // Number of used bytes
+    len_t max_bytes;                 // Number of allocated bytes
+    len_t nr_elements;               // Number of elements
+    data_t last;                     // Last element, the next one is encoded against it
+};
+
+// Define a position in the compressed list, used to walk over its elements
+struct clist_iter {
+    const struct clist* p_clist;     // Compressed list walked over
+    len_t position;                  // Number of elements already returned
+    len_t offset;                    // Position in p_bytes of the next difference
+    data_t data;                     // Last returned element
+};
+
+typedef struct clist_block clist_block_t;   // Typedef for block header structure
+typedef struct clist clist_t;               // Typedef for compressed list structure
+typedef struct clist_iter clist_iter_t;     // Typedef for iterator structure
+
+// Function prototypes for the operations that can be performed on the compressed list
+clist_t* create_clist(list_t* p_list);                          // Compress a sorted list, NULL if the list is not sorted
+list_t* clist_to_list(clist_t* p_clist);                        // Return new list holding the elements of the compressed list
+len_t clist_size(clist_t* p_clist);                             // Get the number of elements
+long clist_memory(clist_t* p_clist);                            // Get the number of bytes used by the compressed list
+int clist_search_data(clist_t* p_clist, data_t f_data);         // Search for a specific value, decoding a single block
+void clist_iter_init(clist_iter_t* p_iter, clist_t* p_clist);   // Start walking over the elements
+int clist_iter_next(clist_iter_t* p_iter, data_t* p_data);      // Get the next element, 0 after the last one
+clist_t* clist_merge(clist_t* p_clist_1, clist_t* p_clist_2);   // Return new compressed list merging two compressed lists
+status_t destroy_clist(clist_t** pp_clist);                     // Destroy the compressed list and free memory
+
+// Helper routines used internally by the interface functions
+static clist_t* clist_new(void);                                // Create an empty compressed list
+static void clist_append(clist_t* p_clist, data_t data);        // Append an element not lower than the last one
+static void clist_put_varint(clist_t* p_clist, unsigned int value); // Append a variable length integer
+static unsigned int clist_get_varint(const unsigned char* p_bytes, len_t* p_offset); // Read a variable length integer
+static void clist_shrink(clist_t* p_clist);                     // Release the unused capacity
+static void* xrealloc(void* p, long size);                      // Helper function to resize memory
+
+#endif /*_COMPRESSED_H*/
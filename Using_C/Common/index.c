@@ -0,0 +1,164 @@
+/**
+ * @file index.c
+ * @author Akash_Thorat
+ * @brief Implementation of the hash index which can be kept over a linked list.
+ * @version 0.1
+ * @date 2024-04-28
+ *
+ * This file contains the implementation of the hash index. Keys are spread with
+ * an integer mixing hash, collisions are resolved by linear probing and
+ * the table is doubled whenever it becomes half full. Removing an entry shifts the
+ * following entries of its probe sequence back, so no tombstones are needed.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (index.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "index.h"
+
+// Create an empty index with room for nr_keys keys
+index_t* create_index(len_t nr_keys)
+{
+    index_t* p_index = NULL;
+    len_t capacity = INDEX_MIN_CAPACITY;
+
+    while (capacity < 2 * nr_keys)
+        capacity = capacity * 2;
+
+    p_index = (index_t*) xcalloc(1, sizeof(index_t));
+    p_index->p_entries = (index_entry_t*) xcalloc(capacity, sizeof(index_entry_t));
+    p_index->capacity = capacity;
+    p_index->nr_keys = 0;
+    p_index->order_step = 1;
+
+    return (p_index);
+}
+
+// Get the entry of key, NULL if key is not in the index
+index_entry_t* index_find(index_t* p_index, data_t key)
+{
+    len_t slot = 0;
+
+    for (slot = index_slot(p_index, key); p_index->p_entries[slot].count != 0;
+         slot = (slot + 1) & (p_index->capacity - 1))
+    {
+        if (p_index->p_entries[slot].key == key)
+            return (&p_index->p_entries[slot]);
+    }
+    return (NULL);
+}
+
+// Get the entry of key, a new entry with a zero count is added if key is absent
+index_entry_t* index_insert(index_t* p_index, data_t key)
+{
+    index_entry_t* p_entry = NULL;
+    len_t slot = 0;
+
+    p_entry = index_find(p_index, key);
+    if (p_entry != NULL)
+        return (p_entry);
+
+    if (2 * (p_index->nr_keys + 1) > p_index->capacity)
+        index_grow(p_index);
+
+    slot = index_slot(p_index, key);
+    while (p_index->p_entries[slot].count != 0)
+        slot = (slot + 1) & (p_index->capacity - 1);
+
+    p_entry = &p_index->p_entries[slot];
+    p_entry->key = key;
+    p_entry->count = 0;
+    p_entry->p_prev = NULL;
+    p_index->nr_keys = p_index->nr_keys + 1;
+    return (p_entry);
+}
+
+// Remove an entry, the entries probing past its slot are moved back
+void index_erase(index_t* p_index, index_entry_t* p_entry)
+{
+    len_t mask = p_index->capacity - 1;
+    len_t hole = 0;
+    len_t slot = 0;
+    len_t home = 0;
+
+    hole = (len_t) (p_entry - p_index->p_entries);
+    slot = hole;
+    for (;;)
+    {
+        slot = (slot + 1) & mask;
+        if (p_index->p_entries[slot].count == 0)
+            break;
+        home = index_slot(p_index, p_index->p_entries[slot].key);
+        // Move the entry back unless its home slot lies cyclically in (hole, slot]
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            p_index->p_entries[hole] = p_index->p_entries[slot];
+            hole = slot;
+        }
+    }
+    p_index->p_entries[hole].count = 0;
+    p_index->p_entries[hole].p_prev = NULL;
+    p_index->nr_keys = p_index->nr_keys - 1;
+}
+
+// Remove all entries from the index
+void index_clear(index_t* p_index)
+{
+    for (len_t slot = 0; slot < p_index->capacity; ++slot)
+    {
+        p_index->p_entries[slot].count = 0;
+        p_index->p_entries[slot].p_prev = NULL;
+    }
+    p_index->nr_keys = 0;
+}
+
+// Destroy the index and free memory
+status_t destroy_index(index_t** pp_index)
+{
+    free((*pp_index)->p_entries);
+    free(*pp_index);
+    *pp_index = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Get the home slot of key
+static len_t index_slot(index_t* p_index, data_t key)
+{
+    unsigned int hash = (unsigned int) key;
+
+    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;
+    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;
+    hash = hash ^ (hash >> 16);
+    return ((len_t) (hash & (unsigned int) (p_index->capacity - 1)));
+}
+
+// Double the number of slots and insert every entry again
+static void index_grow(index_t* p_index)
+{
+    index_entry_t* p_old_entries = NULL;
+    index_entry_t* p_entry = NULL;
+    len_t old_capacity = 0;
+    len_t slot = 0;
+
+    p_old_entries = p_index->p_entries;
+    old_capacity = p_index->capacity;
+
+    p_index->capacity = old_capacity * 2;
+    p_index->p_entries = (index_entry_t*) xcalloc(p_index->capacity, sizeof(index_entry_t));
+
+    for (len_t i = 0; i < old_capacity; ++i)
+    {
+        if (p_old_entries[i].count == 0)
+            continue;
+        slot = index_slot(p_index, p_old_entries[i].key);
+        while (p_index->p_entries[slot].count != 0)
+            slot = (slot + 1) & (p_index->capacity - 1);
+        p_entry = &p_index->p_entries[slot];
+        *p_entry = p_old_entries[i];
+    }
+    free(p_old_entries);
+}
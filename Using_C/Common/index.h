@@ -0,0 +1,64 @@
+/**
+ * @file index.h
+ * @author Akash_Thorat
+ * @brief Header file defining the hash index which can be kept over a linked list.
+ * @version 0.1
+ * @date 2024-04-28
+ *
+ * This header file contains the declarations for an open addressing hash table
+ * (linear probing) which maps an element of the list to the node before its first
+ * occurrence and to the number of its occurrences. Keeping the predecessor lets
+ * the list find an element, insert before it and delete it in expected constant
+ * time, without walking the list.
+ *
+ * While the index is kept, every node also carries an order label which grows
+ * along the list (see order_label() in list.c). Comparing the labels tells which
+ * of two occurrences of an element comes first, so inserting a duplicate keeps
+ * the first occurrence right in expected constant time. Removing the first of
+ * several occurrences still walks from it to the next occurrence, which costs
+ * O(n / count) for occurrences spread over the list.
+ *
+ * The table only stores the entries, keeping them in sync with the list is done
+ * by list.c (see enable_index()). Like pool.c, the index is shared by the keyed
+ * variants and compiled against the list.h of each of them.
+ */
+
+#ifndef _INDEX_H
+#define _INDEX_H
+
+#include "list.h"
+
+#define INDEX_MIN_CAPACITY 16        // Number of slots of an empty index
+#define INDEX_ORDER_SPACE 0x100000000ull  // Number of order labels, the dummy node takes label 0
+
+// Define the structure of an entry of the index
+struct index_entry {
+    data_t key;              // Element of the list
+    len_t count;             // Number of occurrences of key, 0 for a free slot
+    node_t* p_prev;          // Node before the first occurrence of key
+};
+
+// Define the structure of the index
+struct index {
+    struct index_entry* p_entries;   // Slots of the table
+    len_t capacity;                  // Number of slots, always a power of two
+    len_t nr_keys;                   // Number of used slots
+    unsigned int order_step;         // Gap between the order labels of appended nodes
+};
+
+typedef struct index_entry index_entry_t;   // Typedef for entry structure
+typedef struct index index_t;               // Typedef for index structure
+
+// Function prototypes for the operations that can be performed on the index
+index_t* create_index(len_t nr_keys);                           // Create an index sized for nr_keys keys
+index_entry_t* index_find(index_t* p_index, data_t key);        // Get the entry of key, NULL if absent
+index_entry_t* index_insert(index_t* p_index, data_t key);      // Get the entry of key, adding an empty one if absent
+void index_erase(index_t* p_index, index_entry_t* p_entry);     // Remove an entry from the index
+void index_clear(index_t* p_index);                             // Remove all entries from the index
+status_t destroy_index(index_t** pp_index);                     // Destroy the index and free memory
+
+// Helper routines used internally by the interface functions
+static len_t index_slot(index_t* p_index, data_t key);          // Get the home slot of key
+static void index_grow(index_t* p_index);                       // Double the number of slots
+
+#endif /*_INDEX_H*/
@@ -0,0 +1,227 @@
+/**
+ * @file mapped.c
+ * @author Akash_Thorat
+ * @brief Implementation of the binary file format of a list and its memory mapped view.
+ * @version 0.1
+ * @date 2024-05-17
+ *
+ * This file contains the implementation of save_list() and of the mapped list.
+ * save_list() gathers the elements into a buffer of MAPPED_BUFFER_ELEMENTS and
+ * writes the buffer at once. map_list() checks the header and the size of the
+ * file, then maps it read only, the operations of the mapped list index the
+ * array of elements directly. mlist_to_list() takes all the nodes of the new list
+ * from a single block of its pool.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (mapped.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "mapped.h"
+#include "pool.h"
+#include "stats.h"
+
+#define MAPPED_BUFFER_ELEMENTS 4096  // Number of elements written at once by save_list()
+
+// Write the header and the elements of the list to a binary file
+status_t save_list(list_t* p_list, const char* path)
+{
+    mapped_header_t header;
+    data_t buffer[MAPPED_BUFFER_ELEMENTS];
+    node_t* p_run = NULL;
+    FILE* p_file = NULL;
+    len_t nr_buffered = 0;
+    int sorted = 1;
+
+    p_run = p_list->head.next;
+    for (len_t i = 1; i < size(p_list) && sorted; ++i)
+    {
+        sorted = (p_run->data <= p_run->next->data);
+        p_run = p_run->next;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAPPED_MAGIC, sizeof(MAPPED_MAGIC));
+    header.version = MAPPED_VERSION;
+    header.byte_order = MAPPED_BYTE_ORDER;
+    header.data_size = sizeof(data_t);
+    header.sorted = sorted;
+    header.nr_elements = size(p_list);
+
+    p_file = fopen(path, "wb");
+    if (p_file == NULL)
+        return (LIST_IO_ERROR);
+    if (fwrite(&header, sizeof(header), 1, p_file) != 1)
+    {
+        fclose(p_file);
+        return (LIST_IO_ERROR);
+    }
+
+    p_run = p_list->head.next;
+    for (len_t i = 0; i < size(p_list); ++i)
+    {
+        buffer[nr_buffered++] = p_run->data;
+        p_run = p_run->next;
+        if (nr_buffered == MAPPED_BUFFER_ELEMENTS || i == size(p_list) - 1)
+        {
+            if (fwrite(buffer, sizeof(data_t), nr_buffered, p_file) != (size_t) nr_buffered)
+            {
+                fclose(p_file);
+                return (LIST_IO_ERROR);
+            }
+            nr_buffered = 0;
+        }
+    }
+
+    if (fclose(p_file) != 0)
+        return (LIST_IO_ERROR);
+    return (SUCCESS);
+}
+
+// Map a binary file written by save_list() as a read only list, NULL if the file can not be used
+mlist_t* map_list(const char* path)
+{
+    mlist_t* p_mlist = NULL;
+    const mapped_header_t* p_header = NULL;
+    struct stat file_stat;
+    void* p_map = NULL;
+    uint64_t nr_data_bytes = 0;
+    int fd = -1;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return (NULL);
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size < (off_t) sizeof(mapped_header_t))
+    {
+        close(fd);
+        return (NULL);
+    }
+
+    // The mapping stays valid once the descriptor is closed
+    p_map = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p_map == MAP_FAILED)
+        return (NULL);
+
+    // nr_elements is bounded by the file size before it is multiplied, a corrupt count can not wrap around
+    p_header = (const mapped_header_t*) p_map;
+    nr_data_bytes = (uint64_t) file_stat.st_size - sizeof(mapped_header_t);
+    if (memcmp(p_header->magic, MAPPED_MAGIC, sizeof(MAPPED_MAGIC)) != 0 ||
+        p_header->version != MAPPED_VERSION ||
+        p_header->byte_order != MAPPED_BYTE_ORDER ||
+        p_header->data_size != sizeof(data_t) ||
+        p_header->nr_elements > INT_MAX ||
+        p_header->nr_elements > nr_data_bytes / sizeof(data_t) ||
+        nr_data_bytes != p_header->nr_elements * sizeof(data_t))
+    {
+        munmap(p_map, file_stat.st_size);
+        return (NULL);
+    }
+
+    p_mlist = (mlist_t*) xcalloc(1, sizeof(mlist_t));
+    p_mlist->p_header = p_header;
+    p_mlist->p_data = (const data_t*) (p_header + 1);
+    p_mlist->nr_elements = (len_t) p_header->nr_elements;
+    p_mlist->map_size = (long) file_stat.st_size;
+
+    return (p_mlist);
+}
+
+// Get the number of elements of the mapped list
+len_t mlist_size(mlist_t* p_mlist)
+{
+    return (p_mlist->nr_elements);
+}
+
+// Get the first element of the mapped list
+status_t mlist_get_start(mlist_t* p_mlist, data_t* p_start_data)
+{
+    return (mlist_get_at(p_mlist, 0, p_start_data));
+}
+
+// Get the last element of the mapped list
+status_t mlist_get_end(mlist_t* p_mlist, data_t* p_end_data)
+{
+    return (mlist_get_at(p_mlist, p_mlist->nr_elements - 1, p_end_data));
+}
+
+// Get the element at a position, LIST_DATA_NOT_FOUND if there is no such position
+status_t mlist_get_at(mlist_t* p_mlist, len_t position, data_t* p_data)
+{
+    if (p_mlist->nr_elements == 0)
+        return (LIST_EMPTY);
+    if (position < 0 || position >= p_mlist->nr_elements)
+        return (LIST_DATA_NOT_FOUND);
+    *p_data = p_mlist->p_data[position];
+    return (SUCCESS);
+}
+
+// Search for a specific value, a binary search when the file was saved sorted
+int mlist_search_data(mlist_t* p_mlist, data_t f_data)
+{
+    len_t low = 0;
+    len_t high = p_mlist->nr_elements;
+    len_t middle = 0;
+
+    if (!p_mlist->p_header->sorted)
+    {
+        for (len_t i = 0; i < p_mlist->nr_elements; ++i)
+            if (p_mlist->p_data[i] == f_data)
+                return (1);
+        return (0);
+    }
+
+    // First position whose element is not lower than f_data
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        if (p_mlist->p_data[middle] < f_data)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return (low < p_mlist->nr_elements && p_mlist->p_data[low] == f_data);
+}
+
+// Return new list holding a copy of the elements, its nodes are taken from one block of its pool
+list_t* mlist_to_list(mlist_t* p_mlist)
+{
+    list_t* p_list = NULL;
+    node_t* p_block = NULL;
+    len_t length = 0;
+
+    p_list = create_list();
+    length = p_mlist->nr_elements;
+    if (length == 0)
+        return (p_list);
+
+    p_block = pool_alloc_block(p_list->p_pool, length);
+    STATS_NODE_ALLOCS(length);
+    for (len_t i = 0; i < length; ++i)
+    {
+        p_block[i].data = p_mlist->p_data[i];
+        p_block[i].next = &p_block[i + 1];
+    }
+    p_block[length - 1].next = LIST_END(p_list);
+
+    p_list->head.next = p_block;
+    p_list->p_tail = &p_block[length - 1];
+    p_list->nr_elements = length;
+    return (p_list);
+}
+
+// Unmap the file and free memory
+status_t unmap_list(mlist_t** pp_mlist)
+{
+    munmap((void*) (*pp_mlist)->p_header, (*pp_mlist)->map_size);
+    free(*pp_mlist);
+    *pp_mlist = NULL;
+    return (SUCCESS);
+}
@@ -0,0 +1,65 @@
+/**
+ * @file mapped.h
+ * @author Akash_Thorat
+ * @brief Header file defining the binary file format of a list and its memory mapped view.
+ * @version 0.1
+ * @date 2024-05-17
+ *
+ * This header file contains the declarations for saving a list to a binary file
+ * and for mapping such a file back into memory. The file starts with a header
+ * followed by the elements in list order, as a packed array of data_t. A mapped
+ * list reads the elements straight from the pages of the file, nothing is
+ * allocated per element and nothing is read before it is used.
+ *
+ * A mapped list is read only. mlist_to_list() copies it into a normal list when
+ * it has to be changed. The file is written in the byte order of the machine,
+ * map_list() refuses a file written with another byte order.
+ *
+ * Like compressed.c, the mapped list is shared by the singly variants and
+ * compiled against the list.h of each of them, LIST_END() closes the nodes
+ * built by mlist_to_list() the way the variant ends its lists.
+ */
+
+#ifndef _MAPPED_H
+#define _MAPPED_H
+
+#include <stdint.h>
+#include "list.h"
+
+#define MAPPED_MAGIC "LISTDAT"       // First bytes of a list file
+#define MAPPED_VERSION 1             // Version of the file format
+#define MAPPED_BYTE_ORDER 0x01020304u // Written as is, read back differently on a machine of another byte order
+
+// Define the header of a list file
+struct mapped_header {
+    char magic[8];               // MAPPED_MAGIC, terminated by a zero
+    uint32_t version;            // MAPPED_VERSION
+    uint32_t byte_order;         // MAPPED_BYTE_ORDER
+    uint32_t data_size;          // sizeof(data_t)
+    uint32_t sorted;             // Non zero if the elements are sorted
+    uint64_t nr_elements;        // Number of elements following the header
+};
+
+// Define the structure of a mapped list
+struct mlist {
+    const struct mapped_header* p_header;    // Start of the mapping
+    const data_t* p_data;                    // Elements, right after the header
+    len_t nr_elements;                       // Number of elements
+    long map_size;                           // Number of mapped bytes
+};
+
+typedef struct mapped_header mapped_header_t;   // Typedef for file header structure
+typedef struct mlist mlist_t;                   // Typedef for mapped list structure
+
+// Function prototypes for the operations that can be performed on the file and on the mapped list
+status_t save_list(list_t* p_list, const char* path);                    // Write the list to a binary file, LIST_IO_ERROR on failure
+mlist_t* map_list(const char* path);                                     // Map a binary file as a read only list, NULL on failure
+len_t mlist_size(mlist_t* p_mlist);                                      // Get the number of elements
+status_t mlist_get_start(mlist_t* p_mlist, data_t* p_start_data);        // Get the first element
+status_t mlist_get_end(mlist_t* p_mlist, data_t* p_end_data);            // Get the last element
+status_t mlist_get_at(mlist_t* p_mlist, len_t position, data_t* p_data); // Get the element at a position, for traversals
+int mlist_search_data(mlist_t* p_mlist, data_t f_data);                  // Search for a specific value, binary search if the file is sorted
+list_t* mlist_to_list(mlist_t* p_mlist);                                 // Return new list holding a copy of the elements
+status_t unmap_list(mlist_t** pp_mlist);                                 // Unmap the file and free memory
+
+#endif /*_MAPPED_H*/
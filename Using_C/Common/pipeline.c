@@ -0,0 +1,270 @@
+/**
+ * @file pipeline.c
+ * @author Akash_Thorat
+ * @brief Implementation of lazy pipelines over a linked list.
+ * @version 0.1
+ * @date 2024-05-20
+ *
+ * This file contains the implementation of the pipeline. A run pulls the
+ * elements one at a time with pipeline_next(), which reads the next node of the
+ * source and applies the stages in order until a filter drops the element or
+ * every stage was applied. Take and zip stages set done as soon as they can not
+ * let another element through, so the source is not read any further.
+ *
+ * pipeline_to_list() links the elements into a chain of its own and appends the
+ * chain to the new list at the end, as the text loader does. Its nodes are taken
+ * from the pool in blocks sized after pipeline_bound(), the nodes of the last
+ * block which were not used go back to the pool.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (pipeline.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "pipeline.h"
+#include "pool.h"
+#include "stats.h"
+
+// Start an empty pipeline over p_source
+pipeline_t* pipeline_init(pipeline_t* p_pipeline, list_t* p_source)
+{
+    p_pipeline->p_source = p_source;
+    p_pipeline->nr_stages = 0;
+    p_pipeline->p_next = NULL;
+    p_pipeline->nr_left = 0;
+    p_pipeline->done = 0;
+    return (p_pipeline);
+}
+
+// Add a stage replacing every element by map(element)
+pipeline_t* pipeline_map(pipeline_t* p_pipeline, map_fn_t map, void* p_ctx)
+{
+    pipeline_stage_t* p_stage = NULL;
+    p_stage = pipeline_add_stage(p_pipeline, STAGE_MAP);
+    p_stage->map = map;
+    p_stage->p_ctx = p_ctx;
+    return (p_pipeline);
+}
+
+// Add a stage keeping the elements for which filter returns non zero
+pipeline_t* pipeline_filter(pipeline_t* p_pipeline, predicate_t filter, void* p_ctx)
+{
+    pipeline_stage_t* p_stage = NULL;
+    p_stage = pipeline_add_stage(p_pipeline, STAGE_FILTER);
+    p_stage->filter = filter;
+    p_stage->p_ctx = p_ctx;
+    return (p_pipeline);
+}
+
+// Add a stage keeping the first limit elements reaching it
+pipeline_t* pipeline_take(pipeline_t* p_pipeline, len_t limit)
+{
+    pipeline_stage_t* p_stage = NULL;
+    p_stage = pipeline_add_stage(p_pipeline, STAGE_TAKE);
+    p_stage->limit = limit;
+    return (p_pipeline);
+}
+
+// Add a stage combining every element reaching it with the next element of p_other, it ends with p_other
+pipeline_t* pipeline_zip(pipeline_t* p_pipeline, list_t* p_other, zip_fn_t zip, void* p_ctx)
+{
+    pipeline_stage_t* p_stage = NULL;
+    p_stage = pipeline_add_stage(p_pipeline, STAGE_ZIP);
+    p_stage->p_other = p_other;
+    p_stage->zip = zip;
+    p_stage->p_ctx = p_ctx;
+    return (p_pipeline);
+}
+
+// Fold the elements of the pipeline into acc, starting from init
+data_t pipeline_reduce(pipeline_t* p_pipeline, reduce_fn_t reduce, data_t init, void* p_ctx)
+{
+    data_t acc = init;
+    data_t data = 0;
+
+    pipeline_rewind(p_pipeline);
+    while (pipeline_next(p_pipeline, &data))
+        acc = reduce(acc, data, p_ctx);
+    return (acc);
+}
+
+// Count the elements of the pipeline
+len_t pipeline_count(pipeline_t* p_pipeline)
+{
+    len_t count = 0;
+    data_t data = 0;
+
+    pipeline_rewind(p_pipeline);
+    while (pipeline_next(p_pipeline, &data))
+        count = count + 1;
+    return (count);
+}
+
+// Return new list holding the elements of the pipeline, its nodes are taken from the pool in blocks
+list_t* pipeline_to_list(pipeline_t* p_pipeline)
+{
+    list_t* p_list = NULL;
+    node_t chain;
+    node_t* p_last = NULL;
+    node_t* p_block = NULL;
+    len_t nr_block_nodes = 0;
+    len_t nr_used = 0;
+    len_t bound = 0;
+    len_t count = 0;
+    data_t data = 0;
+
+    p_list = create_list();
+    bound = pipeline_bound(p_pipeline);
+    p_last = &chain;
+
+    pipeline_rewind(p_pipeline);
+    while (pipeline_next(p_pipeline, &data))
+    {
+        if (nr_used == nr_block_nodes)
+        {
+            // No more than bound elements can come out, minus those already out
+            nr_block_nodes = bound - count;
+            if (nr_block_nodes > PIPELINE_BLOCK_NODES)
+                nr_block_nodes = PIPELINE_BLOCK_NODES;
+            p_block = pool_alloc_block(p_list->p_pool, nr_block_nodes);
+            nr_used = 0;
+        }
+        p_block[nr_used].data = data;
+        p_last->next = &p_block[nr_used];
+        p_last = p_last->next;
+        nr_used = nr_used + 1;
+        count = count + 1;
+    }
+
+    // Unused nodes of the last block go back to the pool
+    if (p_block != NULL && nr_used < nr_block_nodes)
+    {
+        for (len_t i = nr_used; i < nr_block_nodes - 1; ++i)
+            p_block[i].next = &p_block[i + 1];
+        pool_free_chain(p_list->p_pool, &p_block[nr_used], &p_block[nr_block_nodes - 1]);
+    }
+    if (count == 0)
+        return (p_list);
+    STATS_NODE_ALLOCS(count);
+
+    // head.next of the empty list is the end of the list
+    p_last->next = p_list->head.next;
+    p_list->head.next = chain.next;
+    p_list->p_tail = p_last;
+    p_list->nr_elements = count;
+    return (p_list);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Append a stage of the given kind, the program stops if the pipeline is full
+static pipeline_stage_t* pipeline_add_stage(pipeline_t* p_pipeline, stage_kind_t kind)
+{
+    pipeline_stage_t* p_stage = NULL;
+
+    if (p_pipeline->nr_stages == PIPELINE_MAX_STAGES)
+    {
+        puts("ERROR too many stages in the pipeline ..!");
+        exit(EXIT_FAILURE);
+    }
+    p_stage = &p_pipeline->stages[p_pipeline->nr_stages];
+    p_pipeline->nr_stages = p_pipeline->nr_stages + 1;
+
+    p_stage->kind = kind;
+    p_stage->map = NULL;
+    p_stage->filter = NULL;
+    p_stage->zip = NULL;
+    p_stage->p_ctx = NULL;
+    p_stage->limit = 0;
+    p_stage->p_other = NULL;
+    return (p_stage);
+}
+
+// Start a new run from the first node of the source and of every zipped list
+static void pipeline_rewind(pipeline_t* p_pipeline)
+{
+    pipeline_stage_t* p_stage = NULL;
+
+    p_pipeline->p_next = p_pipeline->p_source->head.next;
+    p_pipeline->nr_left = size(p_pipeline->p_source);
+    p_pipeline->done = 0;
+
+    for (int i = 0; i < p_pipeline->nr_stages; ++i)
+    {
+        p_stage = &p_pipeline->stages[i];
+        p_stage->nr_passed = 0;
+        if (p_stage->kind == STAGE_TAKE && p_stage->limit <= 0)
+            p_pipeline->done = 1;
+        if (p_stage->kind == STAGE_ZIP)
+        {
+            p_stage->p_other_node = p_stage->p_other->head.next;
+            if (size(p_stage->p_other) == 0)
+                p_pipeline->done = 1;
+        }
+    }
+}
+
+// Read source nodes until one goes through every stage, 0 once the run is over
+static int pipeline_next(pipeline_t* p_pipeline, data_t* p_data)
+{
+    pipeline_stage_t* p_stage = NULL;
+    data_t data = 0;
+    int kept = 0;
+
+    while (!p_pipeline->done && p_pipeline->nr_left > 0)
+    {
+        data = p_pipeline->p_next->data;
+        p_pipeline->p_next = p_pipeline->p_next->next;
+        p_pipeline->nr_left = p_pipeline->nr_left - 1;
+
+        kept = 1;
+        for (int i = 0; i < p_pipeline->nr_stages && kept; ++i)
+        {
+            p_stage = &p_pipeline->stages[i];
+            if (p_stage->kind == STAGE_MAP)
+                data = p_stage->map(data, p_stage->p_ctx);
+            else if (p_stage->kind == STAGE_FILTER)
+                kept = p_stage->filter(data, p_stage->p_ctx);
+            else if (p_stage->kind == STAGE_TAKE)
+            {
+                p_stage->nr_passed = p_stage->nr_passed + 1;
+                if (p_stage->nr_passed == p_stage->limit)
+                    p_pipeline->done = 1;   // This element is the last one let through
+            }
+            else
+            {
+                data = p_stage->zip(data, p_stage->p_other_node->data, p_stage->p_ctx);
+                p_stage->p_other_node = p_stage->p_other_node->next;
+                p_stage->nr_passed = p_stage->nr_passed + 1;
+                if (p_stage->nr_passed == size(p_stage->p_other))
+                    p_pipeline->done = 1;   // The zipped list is used up
+            }
+        }
+
+        if (kept)
+        {
+            *p_data = data;
+            return (1);
+        }
+    }
+    return (0);
+}
+
+// Get an upper bound of the number of elements of a run, from the source, the takes and the zipped lists
+static len_t pipeline_bound(pipeline_t* p_pipeline)
+{
+    pipeline_stage_t* p_stage = NULL;
+    len_t bound = 0;
+
+    bound = size(p_pipeline->p_source);
+    for (int i = 0; i < p_pipeline->nr_stages; ++i)
+    {
+        p_stage = &p_pipeline->stages[i];
+        if (p_stage->kind == STAGE_TAKE && p_stage->limit < bound)
+            bound = p_stage->limit;
+        if (p_stage->kind == STAGE_ZIP && size(p_stage->p_other) < bound)
+            bound = size(p_stage->p_other);
+    }
+    return (bound < 0 ? 0 : bound);
+}
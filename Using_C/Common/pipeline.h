@@ -0,0 +1,83 @@
+/**
+ * @file pipeline.h
+ * @author Akash_Thorat
+ * @brief Header file defining lazy pipelines of map, filter, take and zip stages over a linked list.
+ * @version 0.1
+ * @date 2024-05-20
+ *
+ * This header file contains the declarations for a pipeline, which describes a
+ * chain of stages applied to the elements of a source list. Adding a stage only
+ * records it, nothing is computed until the pipeline ends in pipeline_reduce(),
+ * pipeline_count() or pipeline_to_list(). These walk over the source list once
+ * and pass every element through all the stages before reading the next one, so
+ * no intermediate list is built. A take stage, or a zip stage whose other list
+ * is used up, stops the walk early.
+ *
+ * A pipeline lives in storage of the caller and holds at most PIPELINE_MAX_STAGES
+ * stages. It can be run any number of times, but the lists it reads must not be
+ * changed while it runs.
+ *
+ * Like compressed.c, the pipelines are shared by the singly variants and
+ * compiled against the list.h of each of them.
+ */
+
+#ifndef _PIPELINE_H
+#define _PIPELINE_H
+
+#include "list.h"
+
+#define PIPELINE_MAX_STAGES 16       // Largest number of stages of a pipeline
+#define PIPELINE_BLOCK_NODES 4096    // Largest number of nodes taken from the pool at once by pipeline_to_list()
+
+typedef data_t (*map_fn_t)(data_t data, void* p_ctx);                   // Typedef for the routine of a map stage
+typedef data_t (*zip_fn_t)(data_t data, data_t other_data, void* p_ctx); // Typedef for the routine combining zipped elements
+typedef data_t (*reduce_fn_t)(data_t acc, data_t data, void* p_ctx);    // Typedef for the routine folding the elements
+
+// Define the kinds of stages
+typedef enum stage_kind {STAGE_MAP, STAGE_FILTER, STAGE_TAKE, STAGE_ZIP} stage_kind_t;
+
+// Define a stage of the pipeline
+struct pipeline_stage {
+    stage_kind_t kind;           // Kind of the stage
+    map_fn_t map;                // Routine of a map stage
+    predicate_t filter;          // Routine of a filter stage, the elements it selects are kept
+    zip_fn_t zip;                // Routine of a zip stage
+    void* p_ctx;                 // Context passed to the routine
+    len_t limit;                 // Number of elements let through by a take stage
+    list_t* p_other;             // List zipped with the elements reaching a zip stage
+    len_t nr_passed;             // Number of elements which went through the stage during the current run
+    node_t* p_other_node;        // Next node of the zipped list during the current run
+};
+
+// Define the structure of the pipeline
+struct pipeline {
+    list_t* p_source;                                    // List the elements are read from
+    struct pipeline_stage stages[PIPELINE_MAX_STAGES];   // Stages, in the order they are applied
+    int nr_stages;                                       // Number of stages
+    node_t* p_next;                                      // Next node of the source during the current run
+    len_t nr_left;                                       // Number of nodes of the source not read yet
+    int done;                                            // Non zero once the current run can not produce any more element
+};
+
+typedef struct pipeline_stage pipeline_stage_t;  // Typedef for stage structure
+typedef struct pipeline pipeline_t;              // Typedef for pipeline structure
+
+// Function prototypes for building the pipeline
+pipeline_t* pipeline_init(pipeline_t* p_pipeline, list_t* p_source);                 // Start an empty pipeline over p_source
+pipeline_t* pipeline_map(pipeline_t* p_pipeline, map_fn_t map, void* p_ctx);          // Replace every element by map(element)
+pipeline_t* pipeline_filter(pipeline_t* p_pipeline, predicate_t filter, void* p_ctx); // Keep the elements selected by filter
+pipeline_t* pipeline_take(pipeline_t* p_pipeline, len_t limit);                       // Keep the first limit elements
+pipeline_t* pipeline_zip(pipeline_t* p_pipeline, list_t* p_other, zip_fn_t zip, void* p_ctx); // Combine every element with the next one of p_other
+
+// Function prototypes for running the pipeline
+data_t pipeline_reduce(pipeline_t* p_pipeline, reduce_fn_t reduce, data_t init, void* p_ctx); // Fold the elements, starting from init
+len_t pipeline_count(pipeline_t* p_pipeline);                                         // Count the elements
+list_t* pipeline_to_list(pipeline_t* p_pipeline);                                     // Return new list holding the elements
+
+// Helper routines used internally by the interface functions
+static pipeline_stage_t* pipeline_add_stage(pipeline_t* p_pipeline, stage_kind_t kind); // Append a stage
+static void pipeline_rewind(pipeline_t* p_pipeline);                                 // Start a new run
+static int pipeline_next(pipeline_t* p_pipeline, data_t* p_data);                   // Get the next element of the run, 0 at the end
+static len_t pipeline_bound(pipeline_t* p_pipeline);                                // Upper bound of the number of elements
+
+#endif /*_PIPELINE_H*/
@@ -0,0 +1,221 @@
+/**
+ * @file pool.c
+ * @author Akash_Thorat
+ * @brief Implementation of the slab based node pool used by the linked list.
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * This file contains the implementation of the node pool. Nodes are handed out
+ * from the free list first, then from the unused part of the newest slab. When
+ * both are exhausted a new slab is allocated, every slab being twice as big as
+ * the previous one (up to POOL_MAX_SLAB_NODES nodes), so a list of n nodes costs
+ * only O(log n) calls to the system allocator. Slabs taken over from another
+ * pool by pool_merge() are carved before a new slab is allocated.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (pool.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "pool.h"
+
+// Create a new pool without any slab
+pool_t* create_pool(void)
+{
+    pool_t* p_pool = NULL;
+
+    p_pool = (pool_t*) xcalloc(1, sizeof(pool_t));
+    p_pool->p_slabs = NULL;
+    p_pool->p_last_slab = NULL;
+    p_pool->p_pending = NULL;
+    p_pool->p_pending_last = NULL;
+    p_pool->p_bump_slab = NULL;
+    p_pool->p_free = NULL;
+    p_pool->p_free_last = NULL;
+    p_pool->p_bump = NULL;
+    p_pool->p_bump_end = NULL;
+    p_pool->nr_slab_nodes = POOL_MIN_SLAB_NODES;
+
+    return (p_pool);
+}
+
+// Get a node from the free list, or from the bump slab
+node_t* pool_alloc(pool_t* p_pool)
+{
+    node_t* p_node = NULL;
+
+    if (p_pool->p_free != NULL)
+    {
+        p_node = p_pool->p_free;
+        p_pool->p_free = p_node->next;
+        if (p_pool->p_free == NULL)
+            p_pool->p_free_last = NULL;
+        return (p_node);
+    }
+
+    if (p_pool->p_bump == p_pool->p_bump_end)
+        pool_next_bump(p_pool);
+
+    p_node = p_pool->p_bump;
+    p_pool->p_bump = p_pool->p_bump + 1;
+    return (p_node);
+}
+
+// Get nr_nodes contiguous nodes from a new slab holding only them, the nodes are not linked
+node_t* pool_alloc_block(pool_t* p_pool, len_t nr_nodes)
+{
+    slab_t* p_slab = NULL;
+
+    p_slab = (slab_t*) xcalloc(1, sizeof(slab_t) + nr_nodes * sizeof(node_t));
+    p_slab->nr_nodes = nr_nodes;
+
+    // Kept behind the newest slab, whose unused nodes are still handed out by pool_alloc
+    if (p_pool->p_slabs == NULL)
+    {
+        p_pool->p_slabs = p_slab;
+        p_pool->p_last_slab = p_slab;
+    }
+    else
+    {
+        p_slab->p_next = p_pool->p_slabs->p_next;
+        p_pool->p_slabs->p_next = p_slab;
+        if (p_slab->p_next == NULL)
+            p_pool->p_last_slab = p_slab;
+    }
+    return (p_slab->nodes);
+}
+
+// Give a single node back to the pool
+void pool_free(pool_t* p_pool, node_t* p_node)
+{
+    p_node->next = p_pool->p_free;
+    if (p_pool->p_free == NULL)
+        p_pool->p_free_last = p_node;
+    p_pool->p_free = p_node;
+}
+
+// Give the chain of nodes p_first ... p_last back to the pool in constant time
+void pool_free_chain(pool_t* p_pool, node_t* p_first, node_t* p_last)
+{
+    p_last->next = p_pool->p_free;
+    if (p_pool->p_free == NULL)
+        p_pool->p_free_last = p_last;
+    p_pool->p_free = p_first;
+}
+
+// Move all slabs and free nodes of p_src_pool into p_dest_pool in constant time, p_src_pool is left empty
+void pool_merge(pool_t* p_dest_pool, pool_t* p_src_pool)
+{
+    slab_t* p_bump_slab = NULL;
+
+    if (p_src_pool == p_dest_pool || p_src_pool->p_slabs == NULL)
+        return;
+
+    // Unused part of the source bump slab becomes a pending slab, it is not walked
+    if (p_src_pool->p_bump != p_src_pool->p_bump_end)
+    {
+        p_bump_slab = p_src_pool->p_bump_slab;
+        p_bump_slab->p_unused = p_src_pool->p_bump;
+        p_bump_slab->p_next_pending = p_src_pool->p_pending;
+        if (p_src_pool->p_pending == NULL)
+            p_src_pool->p_pending_last = p_bump_slab;
+        p_src_pool->p_pending = p_bump_slab;
+    }
+
+    if (p_src_pool->p_pending != NULL)
+    {
+        p_src_pool->p_pending_last->p_next_pending = p_dest_pool->p_pending;
+        if (p_dest_pool->p_pending == NULL)
+            p_dest_pool->p_pending_last = p_src_pool->p_pending_last;
+        p_dest_pool->p_pending = p_src_pool->p_pending;
+    }
+
+    if (p_src_pool->p_free != NULL)
+        pool_free_chain(p_dest_pool, p_src_pool->p_free, p_src_pool->p_free_last);
+
+    // Source slabs are placed behind the newest destination slab
+    if (p_dest_pool->p_slabs == NULL)
+    {
+        p_dest_pool->p_slabs = p_src_pool->p_slabs;
+        p_dest_pool->p_last_slab = p_src_pool->p_last_slab;
+    }
+    else
+    {
+        p_src_pool->p_last_slab->p_next = p_dest_pool->p_slabs->p_next;
+        p_dest_pool->p_slabs->p_next = p_src_pool->p_slabs;
+        if (p_dest_pool->p_last_slab == p_dest_pool->p_slabs)
+            p_dest_pool->p_last_slab = p_src_pool->p_last_slab;
+    }
+
+    p_src_pool->p_slabs = NULL;
+    p_src_pool->p_last_slab = NULL;
+    p_src_pool->p_pending = NULL;
+    p_src_pool->p_pending_last = NULL;
+    p_src_pool->p_bump_slab = NULL;
+    p_src_pool->p_free = NULL;
+    p_src_pool->p_free_last = NULL;
+    p_src_pool->p_bump = NULL;
+    p_src_pool->p_bump_end = NULL;
+    p_src_pool->nr_slab_nodes = POOL_MIN_SLAB_NODES;
+}
+
+// Release every slab of the pool, and the pool itself
+status_t destroy_pool(pool_t** pp_pool)
+{
+    slab_t* p_slab = NULL;
+    slab_t* p_slab_next = NULL;
+
+    for (p_slab = (*pp_pool)->p_slabs; p_slab != NULL; p_slab = p_slab_next)
+    {
+        p_slab_next = p_slab->p_next;
+        free(p_slab);
+    }
+    free(*pp_pool);
+    *pp_pool = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Allocate a new slab and make it the newest slab of the pool
+static void pool_add_slab(pool_t* p_pool)
+{
+    slab_t* p_slab = NULL;
+
+    p_slab = (slab_t*) xcalloc(1, sizeof(slab_t) + p_pool->nr_slab_nodes * sizeof(node_t));
+    p_slab->nr_nodes = p_pool->nr_slab_nodes;
+    p_slab->p_next = p_pool->p_slabs;
+    if (p_pool->p_slabs == NULL)
+        p_pool->p_last_slab = p_slab;
+    p_pool->p_slabs = p_slab;
+
+    p_pool->p_bump_slab = p_slab;
+    p_pool->p_bump = p_slab->nodes;
+    p_pool->p_bump_end = p_slab->nodes + p_slab->nr_nodes;
+
+    if (p_pool->nr_slab_nodes < POOL_MAX_SLAB_NODES)
+        p_pool->nr_slab_nodes = p_pool->nr_slab_nodes * 2;
+}
+
+// Make the unused nodes of the next pending slab the bump range, allocate a new slab once none is pending
+static void pool_next_bump(pool_t* p_pool)
+{
+    slab_t* p_slab = NULL;
+
+    if (p_pool->p_pending == NULL)
+    {
+        pool_add_slab(p_pool);
+        return;
+    }
+
+    p_slab = p_pool->p_pending;
+    p_pool->p_pending = p_slab->p_next_pending;
+    if (p_pool->p_pending == NULL)
+        p_pool->p_pending_last = NULL;
+    p_slab->p_next_pending = NULL;
+
+    p_pool->p_bump_slab = p_slab;
+    p_pool->p_bump = p_slab->p_unused;
+    p_pool->p_bump_end = p_slab->nodes + p_slab->nr_nodes;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file pool.h
+ * @author Akash_Thorat
+ * @brief Header file defining a slab based node pool used by the linked list.
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * This header file contains the declarations for a pool allocator which carves
+ * list nodes out of large slabs instead of allocating every node separately.
+ * Released nodes are kept on a free list and handed out again by the next
+ * allocation, a whole chain of nodes can be given back in a single call and
+ * destroying the pool releases every slab at once.
+ *
+ * Every list owns a private pool by default (see create_list()). A pool can also
+ * be shared by several lists through create_list_with_pool(), in which case the
+ * caller destroys the pool after the lists which use it. A pool is not thread
+ * safe, lists sharing a pool must not be used from different threads concurrently.
+ *
+ * pool_merge() moves the slabs of one pool into another in constant time. The
+ * never used nodes of the source pool are not walked, the slab holding them is
+ * kept as a pending slab of the destination pool and carved once its own slab
+ * is used up.
+ *
+ * The pool is shared by every variant whose nodes are linked through a next
+ * pointer. It is compiled once per variant against the list.h of that variant,
+ * found through the include path (see the Makefile).
+ */
+
+#ifndef _POOL_H
+#define _POOL_H
+
+#include "list.h"
+
+#define POOL_MIN_SLAB_NODES 16       // Number of nodes in the first slab of a pool
+#define POOL_MAX_SLAB_NODES 65536    // Upper limit for the number of nodes in a slab
+
+// Define the structure of a slab, a single allocation holding many nodes
+struct slab {
+    struct slab* p_next;          // Pointer to the next slab of the pool
+    struct slab* p_next_pending;  // Pointer to the next pending slab of the pool
+    node_t* p_unused;             // First never used node of a pending slab
+    len_t nr_nodes;               // Number of nodes in this slab
+    node_t nodes[];               // Nodes carved from this slab
+};
+
+// Define the structure of the pool
+struct pool {
+    struct slab* p_slabs;         // List of slabs owned by the pool
+    struct slab* p_last_slab;     // Last slab of the list of slabs
+    struct slab* p_pending;       // Slabs taken over by pool_merge() whose unused nodes are still to be carved
+    struct slab* p_pending_last;  // Last pending slab
+    struct slab* p_bump_slab;     // Slab the bump range is carved from
+    node_t* p_free;               // Free list of recycled nodes (linked through next)
+    node_t* p_free_last;          // Last node of the free list
+    node_t* p_bump;               // Next never used node of the bump slab
+    node_t* p_bump_end;           // End of the bump slab
+    len_t nr_slab_nodes;          // Number of nodes for the next slab
+};
+
+typedef struct slab slab_t;  // Typedef for slab structure
+typedef struct pool pool_t;  // Typedef for pool structure
+
+// Function prototypes for the operations that can be performed on the pool
+pool_t* create_pool(void);                                          // Create a new empty pool
+node_t* pool_alloc(pool_t* p_pool);                                 // Get a node from the pool
+node_t* pool_alloc_block(pool_t* p_pool, len_t nr_nodes);           // Get nr_nodes contiguous nodes from a slab of their own
+void pool_free(pool_t* p_pool, node_t* p_node);                     // Give a single node back to the pool
+void pool_free_chain(pool_t* p_pool, node_t* p_first, node_t* p_last); // Give a chain of nodes back to the pool
+void pool_merge(pool_t* p_dest_pool, pool_t* p_src_pool);           // Move all slabs of p_src_pool into p_dest_pool in constant time
+status_t destroy_pool(pool_t** pp_pool);                            // Release every slab of the pool at once
+
+// Helper routines used internally by the interface functions
+static void pool_add_slab(pool_t* p_pool);                          // Allocate a new slab for the pool
+static void pool_next_bump(pool_t* p_pool);                         // Carve the next pending slab, or a new slab once none is pending
+
+#endif /*_POOL_H*/
@@ -0,0 +1,150 @@
+/**
+ * @file skip.c
+ * @author Akash_Thorat
+ * @brief Implementation of the express lanes of the sorted mode of the linked list.
+ * @version 0.1
+ * @date 2024-05-02
+ *
+ * This file contains the implementation of the express lanes. Lanes are numbered
+ * from 1, lane 0 being the node chain of the list which is walked by list.c.
+ * Levels of new towers are drawn from a private xorshift generator, so keeping a
+ * list sorted does not disturb the sequence of rand().
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (skip.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "skip.h"
+
+// Create empty express lanes, p_head_node being the dummy node of the list
+skip_t* create_skip(node_t* p_head_node)
+{
+    skip_t* p_skip = NULL;
+
+    p_skip = (skip_t*) xcalloc(1, sizeof(skip_t));
+    p_skip->p_head = skip_new_tower(p_head_node, SKIP_MAX_LEVEL);
+    p_skip->nr_levels = 0;
+    p_skip->seed = 2463534242u;
+
+    return (p_skip);
+}
+
+// Get the last tower of lane 1 whose element is lower than key (or equal to key
+// when inclusive is set), pp_update[i] receives the same on lane i + 1 if not NULL
+skip_tower_t* skip_search(skip_t* p_skip, data_t key, int inclusive, skip_tower_t** pp_update)
+{
+    skip_tower_t* p_tower = NULL;
+    skip_tower_t* p_next = NULL;
+
+    p_tower = p_skip->p_head;
+    for (len_t level = SKIP_MAX_LEVEL; level > 0; --level)
+    {
+        if (level <= p_skip->nr_levels)
+        {
+            for (p_next = p_tower->next[level - 1]; p_next != NULL; p_next = p_tower->next[level - 1])
+            {
+                if (p_next->key > key || (!inclusive && p_next->key == key))
+                    break;
+                p_tower = p_next;
+            }
+        }
+        if (pp_update != NULL)
+            pp_update[level - 1] = p_tower;
+    }
+    return (p_tower);
+}
+
+// Draw the number of lanes of a new tower, 0 meaning no tower
+len_t skip_random_level(skip_t* p_skip)
+{
+    len_t level = 0;
+
+    do
+    {
+        p_skip->seed ^= p_skip->seed << 13;
+        p_skip->seed ^= p_skip->seed >> 17;
+        p_skip->seed ^= p_skip->seed << 5;
+        if (p_skip->seed % SKIP_P_INVERSE != 0)
+            break;
+        level = level + 1;
+    } while (level < SKIP_MAX_LEVEL);
+
+    return (level);
+}
+
+// Give p_node a tower of nr_levels lanes, linked after the towers of pp_update
+void skip_link(skip_t* p_skip, node_t* p_node, len_t nr_levels, skip_tower_t** pp_update)
+{
+    skip_tower_t* p_tower = NULL;
+
+    if (nr_levels == 0)
+        return;
+
+    p_tower = skip_new_tower(p_node, nr_levels);
+    for (len_t level = 0; level < nr_levels; ++level)
+    {
+        p_tower->next[level] = pp_update[level]->next[level];
+        pp_update[level]->next[level] = p_tower;
+    }
+    if (nr_levels > p_skip->nr_levels)
+        p_skip->nr_levels = nr_levels;
+}
+
+// Remove the tower of p_node from every lane, nothing is done if it has none
+void skip_unlink(skip_t* p_skip, node_t* p_node)
+{
+    skip_tower_t* p_update[SKIP_MAX_LEVEL];
+    skip_tower_t* p_tower = NULL;
+    skip_tower_t* p_run = NULL;
+
+    // Towers of elements equal to the one of p_node are walked to find its own
+    skip_search(p_skip, p_node->data, 0, p_update);
+    p_run = p_update[0]->next[0];
+    while (p_run != NULL && p_run->p_node != p_node && p_run->key == p_node->data)
+        p_run = p_run->next[0];
+    if (p_run == NULL || p_run->p_node != p_node)
+        return;
+
+    p_tower = p_run;
+    for (len_t level = 0; level < p_tower->nr_levels; ++level)
+    {
+        for (p_run = p_update[level]; p_run->next[level] != p_tower; p_run = p_run->next[level])
+            ;
+        p_run->next[level] = p_tower->next[level];
+    }
+    while (p_skip->nr_levels > 0 && p_skip->p_head->next[p_skip->nr_levels - 1] == NULL)
+        p_skip->nr_levels = p_skip->nr_levels - 1;
+    free(p_tower);
+}
+
+// Destroy the express lanes and free memory
+status_t destroy_skip(skip_t** pp_skip)
+{
+    skip_tower_t* p_tower = NULL;
+    skip_tower_t* p_tower_next = NULL;
+
+    for (p_tower = (*pp_skip)->p_head; p_tower != NULL; p_tower = p_tower_next)
+    {
+        p_tower_next = p_tower->next[0];
+        free(p_tower);
+    }
+    free(*pp_skip);
+    *pp_skip = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Allocate a tower of nr_levels lanes for p_node
+static skip_tower_t* skip_new_tower(node_t* p_node, len_t nr_levels)
+{
+    skip_tower_t* p_tower = NULL;
+
+    p_tower = (skip_tower_t*) xcalloc(1, sizeof(skip_tower_t) + nr_levels * sizeof(skip_tower_t*));
+    p_tower->p_node = p_node;
+    p_tower->key = p_node->data;
+    p_tower->nr_levels = nr_levels;
+    return (p_tower);
+}
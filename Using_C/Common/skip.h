@@ -0,0 +1,57 @@
+/**
+ * @file skip.h
+ * @author Akash_Thorat
+ * @brief Header file defining the express lanes of the sorted mode of the linked list.
+ * @version 0.1
+ * @date 2024-05-02
+ *
+ * This header file contains the declarations for the express lanes which turn a
+ * sorted linked list into a skip list. The node chain of the list is the lowest
+ * lane. About one node out of SKIP_P_INVERSE gets a tower, which links it to the
+ * next tower of each level it reaches, and every level up keeps again one tower
+ * out of SKIP_P_INVERSE. Searching starts on the highest lane and drops one level
+ * each time the next tower would overshoot, which takes O(log n) expected steps.
+ *
+ * The lanes only hold towers, keeping them in sync with the node chain is done
+ * by list.c (see enable_sorted_mode()). Like pool.c, the lanes are shared by
+ * the keyed variants and compiled against the list.h of each of them.
+ */
+
+#ifndef _SKIP_H
+#define _SKIP_H
+
+#include "list.h"
+
+#define SKIP_MAX_LEVEL 16            // Number of express lanes above the node chain
+#define SKIP_P_INVERSE 4             // One tower out of SKIP_P_INVERSE reaches the next level
+
+// Define the structure of a tower, the express lane links of one node
+struct skip_tower {
+    node_t* p_node;                  // Node of the list owning the tower
+    data_t key;                      // Copy of the element of the node, read while searching
+    len_t nr_levels;                 // Number of express lanes the tower is part of
+    struct skip_tower* next[];       // next[i] is the next tower on lane i + 1
+};
+
+// Define the structure of the express lanes
+struct skip {
+    struct skip_tower* p_head;       // Tower of the dummy node, part of every lane
+    len_t nr_levels;                 // Number of lanes currently in use
+    unsigned int seed;               // State of the random level generator
+};
+
+typedef struct skip_tower skip_tower_t;     // Typedef for tower structure
+typedef struct skip skip_t;                 // Typedef for express lanes structure
+
+// Function prototypes for the operations that can be performed on the lanes
+skip_t* create_skip(node_t* p_head_node);                           // Create empty lanes starting at the dummy node
+skip_tower_t* skip_search(skip_t* p_skip, data_t key, int inclusive, skip_tower_t** pp_update); // Get the last tower before key
+len_t skip_random_level(skip_t* p_skip);                            // Draw the number of lanes of a new tower
+void skip_link(skip_t* p_skip, node_t* p_node, len_t nr_levels, skip_tower_t** pp_update); // Give a node a tower
+void skip_unlink(skip_t* p_skip, node_t* p_node);                   // Remove the tower of a node, if it has one
+status_t destroy_skip(skip_t** pp_skip);                            // Destroy the lanes and free memory
+
+// Helper routines used internally by the interface functions
+static skip_tower_t* skip_new_tower(node_t* p_node, len_t nr_levels); // Allocate a tower
+
+#endif /*_SKIP_H*/
@@ -0,0 +1,171 @@
+/**
+ * @file stats.c
+ * @author Akash_Thorat
+ * @brief Implementation of the optional instrumentation of the linked list.
+ * @version 0.1
+ * @date 2024-05-19
+ *
+ * This file contains the counters and the routines used by the STATS_ macros.
+ * STATS_BEGIN() declares a stats_scope_t which is closed by stats_scope_end()
+ * when the operation returns, whichever return statement it takes. Only the
+ * outermost operation is timed, a nested one only raises the depth so that its
+ * nodes are accounted to the outer operation.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (stats.h).
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "stats.h"
+
+#ifdef LIST_STATS
+list_stats_t list_stats = {.enabled = 1};
+#else
+list_stats_t list_stats = {.enabled = 0};
+#endif
+
+static int stats_depth = 0;                      // Number of operations in progress
+static stats_op_t stats_current = STATS_NR_OPS;  // Outermost operation in progress
+
+// Names of the operations, in the order of stats_op_t
+static const char* stats_op_names[STATS_NR_OPS] = {
+    "insert_start", "insert_end", "insert_after", "insert_before", "insert_sorted",
+    "get_start", "get_end", "pop_start", "pop_end",
+    "remove_start", "remove_end", "remove_data", "search_data"
+};
+
+// Names of the walks, in the order of stats_walk_t
+static const char* stats_walk_names[STATS_NR_WALKS] = {"search", "cursor"};
+
+// Copy the counters
+void list_stats_get(list_stats_t* p_stats)
+{
+    *p_stats = list_stats;
+}
+
+// Set every counter back to zero
+void list_stats_reset(void)
+{
+    int enabled = list_stats.enabled;
+
+    memset(&list_stats, 0, sizeof(list_stats));
+    list_stats.enabled = enabled;
+}
+
+// Get the name of an operation
+const char* list_stats_op_name(stats_op_t op)
+{
+    if (op < 0 || op >= STATS_NR_OPS)
+        return ("unknown");
+    return (stats_op_names[op]);
+}
+
+// Write the counters as a JSON object, operations which were never called are left out
+int list_stats_dump_json(FILE* p_file)
+{
+    const stats_op_counters_t* p_op = NULL;
+    int first = 1;
+    int last_bucket = 0;
+
+    fprintf(p_file, "{\"enabled\": %s, \"nr_allocs\": %ld, \"alloc_bytes\": %ld, "
+            "\"nr_node_allocs\": %ld, \"nr_node_frees\": %ld, \"nr_lists_destroyed\": %ld, \"walked\": {",
+            list_stats.enabled ? "true" : "false", list_stats.nr_allocs, list_stats.alloc_bytes,
+            list_stats.nr_node_allocs, list_stats.nr_node_frees, list_stats.nr_lists_destroyed);
+    for (int walk = 0; walk < STATS_NR_WALKS; ++walk)
+        fprintf(p_file, "%s\"%s\": %ld", walk > 0 ? ", " : "", stats_walk_names[walk], list_stats.walked[walk]);
+    fputs("}, \"ops\": {", p_file);
+
+    for (int op = 0; op < STATS_NR_OPS; ++op)
+    {
+        p_op = &list_stats.ops[op];
+        if (p_op->nr_calls == 0)
+            continue;
+
+        fprintf(p_file, "%s\"%s\": {\"calls\": %ld, \"nodes\": %ld, \"total_ns\": %lld, \"max_ns\": %lld, \"histogram_ns\": [",
+                first ? "" : ", ", stats_op_names[op], p_op->nr_calls, p_op->nr_nodes, p_op->total_ns, p_op->max_ns);
+        first = 0;
+
+        // Buckets after the last used one are left out
+        last_bucket = 0;
+        for (int i = 0; i < STATS_NR_BUCKETS; ++i)
+            if (p_op->histogram[i] != 0)
+                last_bucket = i;
+        for (int i = 0; i <= last_bucket; ++i)
+            fprintf(p_file, "%s%ld", i > 0 ? ", " : "", p_op->histogram[i]);
+        fputs("]}", p_file);
+    }
+    fputs("}}\n", p_file);
+
+    return (!ferror(p_file));
+}
+
+// Start measuring an operation, only the outermost one is timed
+stats_scope_t stats_scope_begin(stats_op_t op)
+{
+    stats_scope_t scope;
+
+    scope.op = op;
+    scope.start_ns = 0;
+    if (stats_depth == 0)
+    {
+        stats_current = op;
+        scope.start_ns = stats_now_ns();
+    }
+    stats_depth = stats_depth + 1;
+    return (scope);
+}
+
+// Account the call and its latency once the operation returns
+void stats_scope_end(stats_scope_t* p_scope)
+{
+    stats_op_counters_t* p_op = NULL;
+    long long elapsed_ns = 0;
+    int bucket = 0;
+
+    stats_depth = stats_depth - 1;
+    if (p_scope->start_ns == 0)
+        return;
+
+    elapsed_ns = stats_now_ns() - p_scope->start_ns;
+    p_op = &list_stats.ops[p_scope->op];
+    p_op->nr_calls = p_op->nr_calls + 1;
+    p_op->total_ns = p_op->total_ns + elapsed_ns;
+    if (elapsed_ns > p_op->max_ns)
+        p_op->max_ns = elapsed_ns;
+
+    // Bucket of the highest bit set
+    while (elapsed_ns > 1 && bucket < STATS_NR_BUCKETS - 1)
+    {
+        elapsed_ns = elapsed_ns >> 1;
+        bucket = bucket + 1;
+    }
+    p_op->histogram[bucket] = p_op->histogram[bucket] + 1;
+    stats_current = STATS_NR_OPS;
+}
+
+// Count a node walked over, for the helper and for the operation in progress
+void stats_walk(stats_walk_t walk)
+{
+    list_stats.walked[walk] = list_stats.walked[walk] + 1;
+    if (stats_depth > 0)
+        list_stats.ops[stats_current].nr_nodes = list_stats.ops[stats_current].nr_nodes + 1;
+}
+
+// Count an allocation of bytes bytes
+void stats_alloc(long bytes)
+{
+    list_stats.nr_allocs = list_stats.nr_allocs + 1;
+    list_stats.alloc_bytes = list_stats.alloc_bytes + bytes;
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Get a monotonic time stamp in nanoseconds
+static long long stats_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((long long) ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
@@ -0,0 +1,129 @@
+/**
+ * @file stats.h
+ * @author Akash_Thorat
+ * @brief Header file defining the optional instrumentation of the linked list.
+ * @version 0.1
+ * @date 2024-05-19
+ *
+ * This header file contains the declarations for counters kept by list.c when it
+ * is compiled with LIST_STATS defined (see make check-stats). For every operation
+ * of the list it counts the calls and the nodes walked over, and keeps a
+ * histogram of the latencies, bucket i holding the calls which took from 2^i to
+ * 2^(i+1) - 1 nanoseconds. The nodes walked over by the helper routines, the
+ * allocations made by xcalloc() and the nodes taken and given back are counted
+ * as well, including the nodes handed out and released in bulk (destroy_list(),
+ * remove_if(), compact_list(), the loaders, ...). Once every list is destroyed,
+ * as many nodes were given back as were taken.
+ *
+ * Without LIST_STATS the STATS_ macros expand to nothing, so list.c is compiled
+ * exactly as before. The query routines are still there, every counter reads
+ * zero and the JSON tells that the counters are disabled.
+ *
+ * An operation called by another one, such as insert_sorted() by insert_end(),
+ * is accounted to the outer operation. The counters are global and, like the
+ * list itself, not safe to update from several threads at once.
+ *
+ * Like compressed.c, the counters are shared by the singly variants.
+ */
+
+#ifndef _STATS_H
+#define _STATS_H
+
+#include <stdio.h>
+
+#define STATS_NR_BUCKETS 32          // Number of buckets of a latency histogram
+
+// Define the operations having their own counters
+typedef enum stats_op {
+    STATS_INSERT_START,
+    STATS_INSERT_END,
+    STATS_INSERT_AFTER,
+    STATS_INSERT_BEFORE,
+    STATS_INSERT_SORTED,
+    STATS_GET_START,
+    STATS_GET_END,
+    STATS_POP_START,
+    STATS_POP_END,
+    STATS_REMOVE_START,
+    STATS_REMOVE_END,
+    STATS_REMOVE_DATA,
+    STATS_SEARCH_DATA,
+    STATS_NR_OPS
+} stats_op_t;
+
+// Define the helper routines whose walks over the nodes are counted
+typedef enum stats_walk {
+    STATS_WALK_SEARCH,           // search_prev_node() and search_sorted_prev()
+    STATS_WALK_CURSOR,           // cursor_next(), as used by pop_end() and remove_end()
+    STATS_NR_WALKS
+} stats_walk_t;
+
+// Define the counters of one operation
+struct stats_op_counters {
+    long nr_calls;                       // Number of calls
+    long nr_nodes;                       // Number of nodes walked over by the calls
+    long long total_ns;                  // Time spent in the calls
+    long long max_ns;                    // Longest call
+    long histogram[STATS_NR_BUCKETS];    // Number of calls per latency bucket
+};
+
+// Define all the counters
+struct list_stats {
+    int enabled;                                 // Non zero if list.c was compiled with LIST_STATS
+    struct stats_op_counters ops[STATS_NR_OPS];  // Counters per operation
+    long walked[STATS_NR_WALKS];                 // Nodes walked over per helper routine
+    long nr_allocs;                              // Number of calls to xcalloc()
+    long alloc_bytes;                            // Number of bytes allocated by xcalloc()
+    long nr_node_allocs;                         // Number of nodes taken from the pools, one by one or in blocks
+    long nr_node_frees;                          // Number of nodes given back to the pools or released with their pool
+    long nr_lists_destroyed;                     // Number of calls to destroy_list()
+};
+
+// Define an operation in progress, closed when it goes out of scope
+struct stats_scope {
+    stats_op_t op;               // Operation being measured
+    long long start_ns;          // Start of the operation, 0 if it runs inside another one
+};
+
+typedef struct stats_op_counters stats_op_counters_t;  // Typedef for counters of one operation
+typedef struct list_stats list_stats_t;                // Typedef for all the counters
+typedef struct stats_scope stats_scope_t;              // Typedef for an operation in progress
+
+#ifdef LIST_STATS
+#define STATS_BEGIN(op) stats_scope_t stats_scope __attribute__((cleanup(stats_scope_end))) = stats_scope_begin(op)
+#define STATS_WALK(walk) stats_walk(walk)
+#define STATS_ALLOC(bytes) stats_alloc(bytes)
+#define STATS_NODE_ALLOC() (list_stats.nr_node_allocs++)
+#define STATS_NODE_ALLOCS(nr) (list_stats.nr_node_allocs += (nr))
+#define STATS_NODE_FREE() (list_stats.nr_node_frees++)
+#define STATS_NODE_FREES(nr) (list_stats.nr_node_frees += (nr))
+#define STATS_LIST_DESTROYED() (list_stats.nr_lists_destroyed++)
+#else
+#define STATS_BEGIN(op) ((void) 0)
+#define STATS_WALK(walk) ((void) 0)
+#define STATS_ALLOC(bytes) ((void) 0)
+#define STATS_NODE_ALLOC() ((void) 0)
+#define STATS_NODE_ALLOCS(nr) ((void) 0)
+#define STATS_NODE_FREE() ((void) 0)
+#define STATS_NODE_FREES(nr) ((void) 0)
+#define STATS_LIST_DESTROYED() ((void) 0)
+#endif
+
+extern list_stats_t list_stats;      // Counters updated by list.c
+
+// Function prototypes for querying the counters
+void list_stats_get(list_stats_t* p_stats);              // Copy the counters
+void list_stats_reset(void);                             // Set every counter back to zero
+const char* list_stats_op_name(stats_op_t op);           // Get the name of an operation, as used in the JSON
+int list_stats_dump_json(FILE* p_file);                  // Write the counters as a JSON object, 0 on failure
+
+// Routines used by the STATS_ macros
+stats_scope_t stats_scope_begin(stats_op_t op);          // Start measuring an operation
+void stats_scope_end(stats_scope_t* p_scope);            // Account an operation once it returns
+void stats_walk(stats_walk_t walk);                      // Count a node walked over by a helper routine
+void stats_alloc(long bytes);                            // Count an allocation
+
+// Helper routines used internally by the interface functions
+static long long stats_now_ns(void);                     // Get a monotonic time stamp in nanoseconds
+
+#endif /*_STATS_H*/
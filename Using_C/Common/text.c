@@ -0,0 +1,277 @@
+/**
+ * @file text.c
+ * @author Akash_Thorat
+ * @brief Implementation of the buffered text input and output of a linked list.
+ * @version 0.1
+ * @date 2024-05-18
+ *
+ * This file contains the implementation of the text loader and dumper. The
+ * loader keeps the number being parsed in a text_loader_t, so a number cut by
+ * the end of a chunk is completed by the next one. The loaded nodes are linked
+ * into a chain of their own which is appended to the list at the end, the nodes
+ * of the last block which were not used go back to the pool. The dumper formats
+ * the elements itself, without printf.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (text.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include "text.h"
+#include "pool.h"
+#include "stats.h"
+
+// Append the integers read from fd to the list
+status_t load_list_fd(list_t* p_list, int fd)
+{
+    return (text_load(p_list, fd, NULL));
+}
+
+// Append the integers read from p_file to the list
+status_t load_list_file(list_t* p_list, FILE* p_file)
+{
+    return (text_load(p_list, -1, p_file));
+}
+
+// Write the elements of the list to fd
+status_t dump_list_fd(list_t* p_list, int fd, text_format_t format)
+{
+    return (text_dump(p_list, fd, NULL, format));
+}
+
+// Write the elements of the list to p_file
+status_t dump_list_file(list_t* p_list, FILE* p_file, text_format_t format)
+{
+    return (text_dump(p_list, -1, p_file, format));
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Parse the whole input, the elements read before a failure are kept in the list
+static status_t text_load(list_t* p_list, int fd, FILE* p_file)
+{
+    char buffer[TEXT_BUFFER_SIZE];
+    text_loader_t loader;
+    node_t* p_prev = NULL;
+    node_t* p_end = NULL;
+    status_t status = SUCCESS;
+    long length = 0;
+
+    memset(&loader, 0, sizeof(loader));
+    loader.p_last = &loader.head;
+    loader.nr_used = TEXT_BLOCK_NODES;      // First element takes a new block
+
+    while (!loader.overflow && (length = text_read(fd, p_file, buffer, TEXT_BUFFER_SIZE)) > 0)
+        text_parse(p_list, &loader, buffer, length);
+    if (length < 0 || loader.overflow)
+        status = LIST_IO_ERROR;
+    else if (loader.in_number)
+        text_add(p_list, &loader, loader.negative ? (data_t) (0u - loader.value) : (data_t) loader.value);
+
+    // Unused nodes of the last block go back to the pool
+    if (loader.p_block != NULL && loader.nr_used < TEXT_BLOCK_NODES)
+    {
+        for (len_t i = loader.nr_used; i < TEXT_BLOCK_NODES - 1; ++i)
+            loader.p_block[i].next = &loader.p_block[i + 1];
+        pool_free_chain(p_list->p_pool, &loader.p_block[loader.nr_used], &loader.p_block[TEXT_BLOCK_NODES - 1]);
+    }
+    if (loader.nr_loaded == 0)
+        return (status);
+
+    // Elements are appended in input order, the list is no longer kept sorted
+    disable_sorted_mode(p_list);
+    p_prev = is_list_empty(p_list) ? &p_list->head : p_list->p_tail;
+    p_end = p_prev->next;
+    p_prev->next = loader.head.next;
+    loader.p_last->next = p_end;
+    p_list->p_tail = loader.p_last;
+    p_list->nr_elements = p_list->nr_elements + loader.nr_loaded;
+
+    if (p_list->p_index != NULL)
+        enable_index(p_list);
+
+    return (status);
+}
+
+// Format the elements into the buffer, which is written out whenever it is nearly full
+static status_t text_dump(list_t* p_list, int fd, FILE* p_file, text_format_t format)
+{
+    char buffer[TEXT_BUFFER_SIZE];
+    node_t* p_run = NULL;
+    long used = 0;
+
+    if (format == TEXT_ARROWS)
+    {
+        memcpy(buffer, "[START]->", 9);
+        used = 9;
+    }
+
+    p_run = p_list->head.next;
+    for (len_t i = 0; i < size(p_list); ++i)
+    {
+        // An element takes at most 11 digits and sign, and 3 more characters
+        if (used > TEXT_BUFFER_SIZE - 16)
+        {
+            if (!text_write(fd, p_file, buffer, used))
+                return (LIST_IO_ERROR);
+            used = 0;
+        }
+        if (format == TEXT_ARROWS)
+        {
+            buffer[used++] = '[';
+            used = used + text_put_data(&buffer[used], p_run->data);
+            memcpy(&buffer[used], "]->", 3);
+            used = used + 3;
+        }
+        else
+        {
+            used = used + text_put_data(&buffer[used], p_run->data);
+            buffer[used++] = '\n';
+        }
+        p_run = p_run->next;
+    }
+
+    if (format == TEXT_ARROWS)
+    {
+        if (used > TEXT_BUFFER_SIZE - 16)
+        {
+            if (!text_write(fd, p_file, buffer, used))
+                return (LIST_IO_ERROR);
+            used = 0;
+        }
+        memcpy(&buffer[used], "[END]\n", 6);
+        used = used + 6;
+    }
+
+    if (!text_write(fd, p_file, buffer, used))
+        return (LIST_IO_ERROR);
+    return (SUCCESS);
+}
+
+// Parse a chunk of text, a number may continue from the previous chunk and into the next one
+static void text_parse(list_t* p_list, text_loader_t* p_loader, const char* p_buffer, long length)
+{
+    unsigned int limit = 0;
+    unsigned int digit = 0;
+    char c = 0;
+
+    for (long i = 0; i < length; ++i)
+    {
+        c = p_buffer[i];
+        if (c >= '0' && c <= '9')
+        {
+            if (!p_loader->in_number)
+            {
+                p_loader->in_number = 1;
+                p_loader->negative = p_loader->minus;
+                p_loader->value = 0;
+            }
+            // The lowest value of data_t has no positive counterpart
+            limit = (unsigned int) INT_MAX + (p_loader->negative ? 1u : 0u);
+            digit = (unsigned int) (c - '0');
+            if (p_loader->value > (limit - digit) / 10)
+            {
+                p_loader->overflow = 1;
+                return;
+            }
+            p_loader->value = p_loader->value * 10 + digit;
+        }
+        else if (p_loader->in_number)
+        {
+            text_add(p_list, p_loader, p_loader->negative ? (data_t) (0u - p_loader->value) : (data_t) p_loader->value);
+            p_loader->in_number = 0;
+        }
+        p_loader->minus = (c == '-');
+    }
+}
+
+// Append a node holding data to the loaded chain, a new block is taken when the current one is used up
+static void text_add(list_t* p_list, text_loader_t* p_loader, data_t data)
+{
+    node_t* p_node = NULL;
+
+    if (p_loader->nr_used == TEXT_BLOCK_NODES)
+    {
+        p_loader->p_block = pool_alloc_block(p_list->p_pool, TEXT_BLOCK_NODES);
+        p_loader->nr_used = 0;
+    }
+    p_node = &p_loader->p_block[p_loader->nr_used];
+    p_loader->nr_used = p_loader->nr_used + 1;
+    STATS_NODE_ALLOC();
+
+    p_node->data = data;
+    p_loader->p_last->next = p_node;
+    p_loader->p_last = p_node;
+    p_loader->nr_loaded = p_loader->nr_loaded + 1;
+}
+
+// Read a chunk from fd, or from p_file if it is not NULL, 0 at the end of the input and -1 on failure
+static long text_read(int fd, FILE* p_file, char* p_buffer, long length)
+{
+    long nr_read = 0;
+
+    if (p_file != NULL)
+    {
+        nr_read = (long) fread(p_buffer, 1, length, p_file);
+        return ((nr_read == 0 && ferror(p_file)) ? -1 : nr_read);
+    }
+
+    do
+    {
+        nr_read = (long) read(fd, p_buffer, length);
+    } while (nr_read < 0 && errno == EINTR);
+    return (nr_read);
+}
+
+// Write the whole buffer to fd, or to p_file if it is not NULL, returns 0 on failure
+static int text_write(int fd, FILE* p_file, const char* p_buffer, long length)
+{
+    long nr_written = 0;
+
+    if (p_file != NULL)
+        return (fwrite(p_buffer, 1, length, p_file) == (size_t) length);
+
+    // A write may take only part of the buffer
+    while (length > 0)
+    {
+        nr_written = (long) write(fd, p_buffer, length);
+        if (nr_written < 0 && errno == EINTR)
+            continue;
+        if (nr_written <= 0)
+            return (0);
+        p_buffer = p_buffer + nr_written;
+        length = length - nr_written;
+    }
+    return (1);
+}
+
+// Format data in decimal at p_out, returns the number of characters
+static int text_put_data(char* p_out, data_t data)
+{
+    char digits[12];
+    unsigned int value = 0;
+    int nr_digits = 0;
+    int length = 0;
+
+    // Computed on unsigned so that the lowest value can be negated
+    value = (unsigned int) data;
+    if (data < 0)
+    {
+        p_out[length++] = '-';
+        value = 0u - value;
+    }
+    do
+    {
+        digits[nr_digits++] = (char) ('0' + value % 10);
+        value = value / 10;
+    } while (value != 0);
+
+    while (nr_digits > 0)
+        p_out[length++] = digits[--nr_digits];
+    return (length);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file text.h
+ * @author Akash_Thorat
+ * @brief Header file defining the buffered text input and output of a linked list.
+ * @version 0.1
+ * @date 2024-05-18
+ *
+ * This header file contains the declarations for loading a list from text and
+ * for writing a list as text, either through a file descriptor or a FILE*. The
+ * loader reads large chunks and parses the integers in place, the nodes being
+ * taken from the pool TEXT_BLOCK_NODES at a time. The dumper formats the elements
+ * into a large buffer which is written out when it is full, so a list costs a
+ * few write calls instead of one printf per node.
+ *
+ * Every character which is not part of a number separates two numbers, and a
+ * '-' makes the number following it negative. A file written in either format
+ * can therefore be loaded back. A number out of the range of data_t stops the
+ * loader with LIST_IO_ERROR, the elements before it are kept.
+ *
+ * Like compressed.c, the text input and output is shared by the singly variants
+ * and compiled against the list.h of each of them.
+ */
+
+#ifndef _TEXT_H
+#define _TEXT_H
+
+#include <stdio.h>
+#include "list.h"
+
+#define TEXT_BUFFER_SIZE 65536       // Number of bytes read or written at once
+#define TEXT_BLOCK_NODES 4096        // Number of nodes taken from the pool at once by the loader
+
+// Define the layout of the written elements
+typedef enum text_format {
+    TEXT_ARROWS,                 // [START]->[1]->[2]->[END], as printed by show()
+    TEXT_LINES                   // One element per line
+} text_format_t;
+
+// Define the state of the loader between two chunks
+struct text_loader {
+    node_t head;                 // Dummy node, head.next is the first loaded node
+    node_t* p_last;              // Last loaded node
+    node_t* p_block;             // Block the nodes are taken from
+    len_t nr_used;               // Number of nodes of the block already used
+    len_t nr_loaded;             // Number of loaded nodes
+    unsigned int value;          // Digits of the number being parsed
+    int in_number;               // Non zero while a number is being parsed
+    int negative;                // Non zero if the number being parsed is negative
+    int minus;                   // Non zero if the previous character was a '-'
+    int overflow;                // Non zero once a number did not fit in data_t
+};
+
+typedef struct text_loader text_loader_t;   // Typedef for loader structure
+
+// Function prototypes for the text input and output of the list
+status_t load_list_fd(list_t* p_list, int fd);                               // Append the integers read from fd, LIST_IO_ERROR on failure
+status_t load_list_file(list_t* p_list, FILE* p_file);                       // Append the integers read from p_file, LIST_IO_ERROR on failure
+status_t dump_list_fd(list_t* p_list, int fd, text_format_t format);         // Write the list to fd, LIST_IO_ERROR on failure
+status_t dump_list_file(list_t* p_list, FILE* p_file, text_format_t format); // Write the list to p_file, LIST_IO_ERROR on failure
+
+// Helper routines used internally by the interface functions
+static status_t text_load(list_t* p_list, int fd, FILE* p_file);            // Load from fd, or from p_file if it is not NULL
+static status_t text_dump(list_t* p_list, int fd, FILE* p_file, text_format_t format); // Dump to fd, or to p_file if it is not NULL
+static void text_parse(list_t* p_list, text_loader_t* p_loader, const char* p_buffer, long length); // Parse a chunk of text, stop at a number out of range
+static void text_add(list_t* p_list, text_loader_t* p_loader, data_t data); // Append a node to the loaded chain
+static long text_read(int fd, FILE* p_file, char* p_buffer, long length);   // Read a chunk, -1 on failure
+static int text_write(int fd, FILE* p_file, const char* p_buffer, long length); // Write a whole buffer, 0 on failure
+static int text_put_data(char* p_out, data_t data);                         // Format an element in decimal
+
+#endif /*_TEXT_H*/
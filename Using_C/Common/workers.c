@@ -0,0 +1,142 @@
+/**
+ * @file workers.c
+ * @author Akash_Thorat
+ * @brief Implementation of the pool of worker threads used by parallel_sort().
+ * @version 0.1
+ * @date 2024-04-24
+ *
+ * This file contains the implementation of the worker pool. The state of the
+ * current job is guarded by a single mutex. Starting a job bumps a generation
+ * counter and wakes the threads of the pool, every thread then takes the next
+ * task under the mutex and runs it without holding it. The thread finishing the
+ * last task wakes the thread waiting in workers_finish(). The job mutex keeps a
+ * second job from starting before the first one is finished.
+ *
+ * The threads are detached and live as long as the process.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (workers.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "workers.h"
+
+static pthread_mutex_t workers_job_lock = PTHREAD_MUTEX_INITIALIZER;  // Held from workers_start() to workers_finish()
+static pthread_mutex_t workers_lock = PTHREAD_MUTEX_INITIALIZER;      // Guards the state of the current job
+static pthread_cond_t workers_wake = PTHREAD_COND_INITIALIZER;        // Signalled when a job is started
+static pthread_cond_t workers_done = PTHREAD_COND_INITIALIZER;        // Signalled when the last task is done
+
+static int workers_nr_threads = 0;               // Number of threads started
+static unsigned long workers_generation = 0;     // Number of jobs started
+static task_routine_t workers_routine = NULL;    // Routine of the current job
+static char* workers_p_tasks = NULL;             // Tasks of the current job
+static size_t workers_task_size = 0;             // Size of a task
+static int workers_nr_tasks = 0;                 // Number of tasks of the current job
+static int workers_next_task = 0;                // Next task to hand out
+static int workers_nr_done = 0;                  // Number of tasks done
+
+// Run the tasks and wait for them
+void workers_run(task_routine_t routine, void* p_tasks, size_t task_size, int nr_tasks)
+{
+    workers_start(routine, p_tasks, task_size, nr_tasks);
+    workers_finish();
+}
+
+// Hand the tasks to the pool, the pool grows to one thread less than the tasks
+void workers_start(task_routine_t routine, void* p_tasks, size_t task_size, int nr_tasks)
+{
+    pthread_mutex_lock(&workers_job_lock);
+    pthread_mutex_lock(&workers_lock);
+    workers_grow(nr_tasks - 1);
+
+    workers_routine = routine;
+    workers_p_tasks = (char*) p_tasks;
+    workers_task_size = task_size;
+    workers_nr_tasks = nr_tasks;
+    workers_next_task = 0;
+    workers_nr_done = 0;
+    workers_generation = workers_generation + 1;
+    pthread_cond_broadcast(&workers_wake);
+    pthread_mutex_unlock(&workers_lock);
+}
+
+// Run the tasks not taken yet on the calling thread, then wait for the tasks taken by the pool
+void workers_finish(void)
+{
+    pthread_mutex_lock(&workers_lock);
+    workers_run_tasks();
+    while (workers_nr_done < workers_nr_tasks)
+        pthread_cond_wait(&workers_done, &workers_lock);
+    workers_routine = NULL;
+    pthread_mutex_unlock(&workers_lock);
+    pthread_mutex_unlock(&workers_job_lock);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Wait for a job, run its tasks and wait for the next one
+static void* workers_main(void* p_arg)
+{
+    unsigned long seen = 0;
+
+    // A thread started by workers_start() takes part in the job which started it
+    (void) p_arg;
+    pthread_mutex_lock(&workers_lock);
+    while (1)
+    {
+        while (workers_generation == seen)
+            pthread_cond_wait(&workers_wake, &workers_lock);
+        seen = workers_generation;
+        workers_run_tasks();
+    }
+    return (NULL);
+}
+
+// Take the tasks of the current job one by one, the mutex is released while a task runs
+static void workers_run_tasks(void)
+{
+    task_routine_t routine = NULL;
+    void* p_task = NULL;
+
+    while (workers_routine != NULL && workers_next_task < workers_nr_tasks)
+    {
+        routine = workers_routine;
+        p_task = workers_p_tasks + (size_t) workers_next_task * workers_task_size;
+        workers_next_task = workers_next_task + 1;
+
+        pthread_mutex_unlock(&workers_lock);
+        routine(p_task);
+        pthread_mutex_lock(&workers_lock);
+
+        workers_nr_done = workers_nr_done + 1;
+        if (workers_nr_done == workers_nr_tasks)
+            pthread_cond_signal(&workers_done);
+    }
+}
+
+// Start detached threads until the pool holds nr_threads of them
+static void workers_grow(int nr_threads)
+{
+    pthread_attr_t attr;
+    pthread_t thread;
+
+    if (nr_threads > WORKERS_MAX_THREADS)
+        nr_threads = WORKERS_MAX_THREADS;
+    if (workers_nr_threads >= nr_threads)
+        return;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    while (workers_nr_threads < nr_threads)
+    {
+        if (pthread_create(&thread, &attr, workers_main, NULL) != 0)
+        {
+            puts("ERROR while creating thread ..!");
+            exit(EXIT_FAILURE);
+        }
+        workers_nr_threads = workers_nr_threads + 1;
+    }
+    pthread_attr_destroy(&attr);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file workers.h
+ * @author Akash_Thorat
+ * @brief Header file defining the pool of worker threads used by parallel_sort().
+ * @version 0.1
+ * @date 2024-04-24
+ *
+ * This header file contains the declarations for a pool of threads which run the
+ * tasks of a job. A job is an array of nr_tasks tasks of task_size bytes each,
+ * every task is passed to the same routine. The tasks are handed out in order,
+ * one at a time, to the threads of the pool and to the calling thread, which takes
+ * part in the job until every task is done.
+ *
+ * The threads are started the first time a job needs them and then wait for the
+ * next job, so the rounds of parallel_sort() and its later calls do not create
+ * threads again. workers_start() returns as soon as the job is handed out, which
+ * lets the calling thread prepare the input of the tasks while the first ones
+ * already run (see parallel_sort() in list.c), workers_finish() then waits for it.
+ * A single job runs at a time, a thread starting a job waits for the previous one.
+ *
+ * The pool does not use the list, it is shared by every variant.
+ */
+
+#ifndef _WORKERS_H
+#define _WORKERS_H
+
+#include <stddef.h>
+
+#define WORKERS_MAX_THREADS 63       // Upper limit for the threads of the pool, the calling thread comes on top
+
+typedef void (*task_routine_t)(void* p_task);   // Typedef for the routine running one task of a job
+
+// Function prototypes for running jobs on the pool
+void workers_run(task_routine_t routine, void* p_tasks, size_t task_size, int nr_tasks);   // Run the tasks and wait for them
+void workers_start(task_routine_t routine, void* p_tasks, size_t task_size, int nr_tasks); // Hand the tasks to the pool, returns at once
+void workers_finish(void);                                                                // Take part in the job and wait for its tasks
+
+// Helper routines used internally by the interface functions
+static void* workers_main(void* p_arg);                  // Loop of a thread of the pool, runs the tasks of every job
+static void workers_run_tasks(void);                     // Run tasks of the current job until none is left, the lock is held
+static void workers_grow(int nr_threads);                // Start threads until the pool has nr_threads of them
+
+#endif /*_WORKERS_H*/
@@ -0,0 +1,193 @@
+/**
+ * @file list.h
+ * @author Akash_Thorat
+ * @brief Header file defining a doubly linked list data structure and associated functions.
+ * @version 0.1
+ * @date 2024-05-21
+ *
+ * This header file contains the declarations for a doubly linked list, a linked
+ * list in which every node also points to the node before it. Both ends are
+ * reached in constant time, so the list works as a deque: inserting, getting and
+ * removing at the start or at the end never walks the list. A node can be unlinked
+ * without searching for its predecessor, and the list can be walked backwards. It
+ * provides the same interface as the Singly_Linked_List for creating a new list,
+ * inserting elements, removing elements, searching for elements, sorting the list,
+ * and more.
+ *
+ * A cursor stands on a node and moves in both directions. Erasing the current
+ * node, or inserting a node on either side of it, takes constant time. A cursor
+ * is only valid until the list is changed by anything else than the cursor itself.
+ *
+ * The keyed operations of the Singly_Linked_List are provided as well: the hash
+ * index (index.h) and the sorted mode with its express lanes (skip.h) are shared
+ * with it, as are radix_sort(), merge_k_sorted() and remove_all_in().
+ *
+ * Additionally, the header file defines helper routines used internally by the
+ * interface functions and includes necessary typedefs and structure definitions.
+ *
+ * This header file serves as the interface for using the doubly linked list and
+ * is intended to be included in source files where linked list functionality is
+ * required. It should be used in conjunction with the corresponding source file
+ * (list.c) for full functionality.
+ */
+
+
+#ifndef _LIST_H
+#define _LIST_H
+
+#define PARALLEL_SORT_MIN_SEGMENT 4096   // Smallest number of nodes sorted by one thread of parallel_sort()
+#define PARALLEL_SORT_MARK_STRIDE 64     // Distance between the nodes marked for the merges of parallel_sort() split by rank
+#define SORT_MIN_RUN 32                  // Shorter runs are extended by insertion before they are merged
+#define SORT_MAX_RUNS 85                 // Upper limit for the pending runs of the natural merge sort
+#define RADIX_BITS 8                     // Bits of the key distributed by one pass of radix_sort()
+#define RADIX_BUCKETS (1 << RADIX_BITS)  // Number of bucket chains of radix_sort()
+
+// Define the structure of a node in the doubly linked list
+struct node {
+    int data;            // Data stored in the node
+    unsigned int order;  // Label increasing along the list, kept only while the list has a hash index
+    struct node* prev;   // Pointer to the previous node in the list (the dummy node for the first one)
+    struct node* next;   // Pointer to the next node in the list
+};
+
+struct pool;                 // Node pool, defined in pool.h
+struct index;                // Hash index, defined in index.h
+struct skip;                 // Express lanes of the sorted mode, defined in skip.h
+struct skip_tower;           // Tower of the express lanes, defined in skip.h
+struct sort_segment;         // Sorted run of parallel_sort(), defined in list.c
+struct parallel_sort;        // State of parallel_sort(), defined in list.c
+struct sort_task;            // Task of parallel_sort(), defined in list.c
+
+// Define the header of the linked list, kept separate from the nodes
+struct list {
+    struct node head;        // Dummy node, head.next is the first node of the list
+    struct node* p_tail;     // Pointer to the last node (&head when the list is empty)
+    int nr_elements;         // Number of nodes currently in the list
+    struct pool* p_pool;     // Pool from which the nodes of the list are allocated
+    int owns_pool;           // Non zero if the pool is private to this list
+    struct index* p_index;   // Optional hash index over the elements, NULL when disabled
+    struct skip* p_skip;     // Express lanes of the sorted mode, NULL when the list is not kept sorted
+};
+
+// Define a sorted run of nodes found by the natural merge sort
+struct sort_run {
+    struct node* p_first;    // First node of the run
+    struct node* p_last;     // Last node of the run, its next is NULL
+    int length;              // Number of nodes of the run
+};
+
+// Define an entry of the binary heap of merge_k_sorted(), the next node of one of the lists
+struct heap_entry {
+    struct node* p_node;     // Next node to be merged from the list
+    int source;              // Position of the list, equal elements are taken from the lower one first
+};
+
+// Define a position in the list, used to read and edit the list while walking in either direction
+struct cursor {
+    struct list* p_list;     // List walked over
+    struct node* p_current;  // Current node, NULL once moved past either end
+};
+
+// Define typedefs for clarity and abstraction
+typedef enum status {SUCCESS = 1, LIST_EMPTY, LIST_DATA_NOT_FOUND} status_t;  // Status codes for list operations
+typedef struct node node_t;  // Typedef for node structure
+typedef struct list list_t;   // Typedef for the entire linked list
+typedef struct cursor cursor_t;  // Typedef for cursor structure
+typedef int data_t;           // Typedef for data stored in nodes
+typedef int len_t;            // Typedef for length/size of the list
+typedef void (*merge_callback_t)(data_t data, void* p_ctx);  // Typedef for the routine receiving merged elements
+typedef int (*predicate_t)(data_t data, void* p_ctx);        // Typedef for the routine selecting elements, non zero if selected
+
+// Function prototypes for the operations that can be performed on the list
+list_t* create_list(void);  // Create a new linked list
+list_t* create_list_with_pool(struct pool* p_pool);         // Create a new linked list which takes its nodes from a shared pool
+status_t insert_start(list_t* p_list, data_t new_data);     // Insert data at the beginning of the list
+status_t insert_end(list_t* p_list, data_t new_data);       // Insert data at the end of the list
+status_t insert_after(list_t* p_list, data_t e_data, data_t new_data);  // Insert data after a specific value
+status_t insert_before(list_t* p_list, data_t e_data, data_t new_data); // Insert data before a specific value
+status_t get_start(list_t* p_list, data_t* p_start_data);   // Get the first element of the list
+status_t get_end(list_t* p_list, data_t* p_end_data);       // Get the last element of the list
+status_t pop_start(list_t* p_list, data_t* p_start_data);   // Remove and retrieve the first element of the list
+status_t pop_end(list_t* p_list, data_t* p_end_data);       // Remove and retrieve the last element of the list
+status_t remove_start(list_t* p_list);                      // Remove the first element of the list
+status_t remove_end(list_t* p_list);                        // Remove the last element of the list
+status_t remove_data(list_t* p_list, data_t r_data);         // Remove a specific value from the list
+len_t remove_if(list_t* p_list, predicate_t predicate, void* p_ctx); // Remove the elements selected by predicate in one pass, return their number
+len_t remove_all_in(list_t* p_list, const data_t* p_keys, int nr_keys); // Remove every occurrence of the keys in one pass, return their number
+int search_data(list_t* p_list, data_t f_data);             // Search for a specific value in the list
+len_t count_data(list_t* p_list, data_t c_data);            // Count the occurrences of a specific value in the list
+status_t enable_index(list_t* p_list);                      // Keep a hash index for constant time keyed operations
+void disable_index(list_t* p_list);                         // Drop the hash index of the list
+status_t enable_sorted_mode(list_t* p_list);                // Sort the list and keep it sorted with express lanes
+void disable_sorted_mode(list_t* p_list);                   // Drop the express lanes of the list
+status_t insert_sorted(list_t* p_list, data_t new_data);    // Insert data keeping the list sorted
+len_t count_range(list_t* p_list, data_t low, data_t high); // Count the elements within [low, high]
+list_t* get_range(list_t* p_list, data_t low, data_t high); // Return new list of the elements within [low, high]
+
+void cursor_init(cursor_t* p_cursor, list_t* p_list);      // Place the cursor on the first node of the list
+void cursor_init_end(cursor_t* p_cursor, list_t* p_list);  // Place the cursor on the last node of the list
+status_t cursor_find(cursor_t* p_cursor, data_t f_data);    // Move the cursor to the first node holding f_data
+status_t cursor_next(cursor_t* p_cursor);                   // Move the cursor to the next node
+status_t cursor_prev(cursor_t* p_cursor);                   // Move the cursor to the previous node
+status_t cursor_get(cursor_t* p_cursor, data_t* p_data);    // Get the data of the current node
+status_t cursor_insert_after(cursor_t* p_cursor, data_t new_data);  // Insert data after the current node
+status_t cursor_insert_before(cursor_t* p_cursor, data_t new_data); // Insert data before the current node
+status_t cursor_erase(cursor_t* p_cursor);                  // Remove the current node, the cursor moves to the next one
+
+list_t* add_lists(list_t* p_list_1, list_t* p_list_2);      // Add given two list in new list and retuen new list
+void concat_lists(list_t* p_list_1, list_t* p_list_2);      // Concatenates the second list to the end of the first list
+list_t* get_merged_list(list_t* p_list_1, list_t* p_list_2); // Return new list by merging two list
+list_t* merge_k_sorted(list_t** pp_lists, int k);            // Return new list by merging k sorted lists, their nodes are moved
+len_t merge_k_sorted_stream(list_t** pp_lists, int k, merge_callback_t callback, void* p_ctx); // Pass the merged elements of k sorted lists to callback
+list_t* get_reversed_list(list_t* p_list);             // Return Reversed List(Reversed by value)
+void reverse_list(list_t* p_list);                     // reverce the list(Reversed by node)
+void sort(list_t* p_list);                                  // Sort the list
+void parallel_sort(list_t* p_list, int nr_threads);         // Sort the list on nr_threads threads, same result as sort()
+void radix_sort(list_t* p_list);                            // Sort the list in linear time, same result as sort()
+void compact_list(list_t* p_list);                          // Move the nodes into one block, in traversal order
+
+int is_list_empty(list_t* p_list);                          // Check if the list is empty
+len_t size(list_t* p_list);                                 // Get the size/length of the list
+void show(list_t* p_list, const char* msg);                  // Display the contents of the list
+void show_reverse(list_t* p_list, const char* msg);          // Display the contents of the list from the last element
+status_t destroy_list(list_t** pp_list);                    // Destroy the list and free memory
+
+
+// Helper routines used internally by the interface functions
+static void generic_insert(list_t* p_list, node_t* p_prev, node_t* p_new_node);  // Link a new node after p_prev
+static node_t* unlink_node(list_t* p_list, node_t* p_node);         // Unlink a node from the list and return it
+static void delete_node(list_t* p_list, node_t* p_node);            // Unlink a node and give it back to the pool
+static int key_in_index(data_t data, void* p_index);                // Check if data is a key of the index
+static node_t* search_node(list_t* p_list, data_t s_data);          // Search for the node containing specific data
+static node_t* search_sorted_prev(list_t* p_list, data_t key, int inclusive, struct skip_tower** pp_update); // Search the position of key in a sorted list
+static int keeps_order(list_t* p_list, node_t* p_prev, data_t new_data); // Check if inserting after p_prev keeps the list sorted
+static node_t* get_new_node(list_t* p_list, data_t new_data);       // Create a new node with data
+static void sort_chain(node_t* p_head);                             // Natural merge sort of the chain after p_head by its next pointers
+static node_t* find_run(node_t* p_first, struct sort_run* p_run);   // Cut the next run off a chain, return the rest
+static void insert_into_run(struct sort_run* p_run, node_t* p_node); // Insert a node into a run after its equal elements
+static int collapse_runs(struct sort_run* p_runs, int nr_runs);     // Merge pending runs until their lengths are balanced
+static void merge_runs(struct sort_run* p_runs, int nr_runs, int i); // Merge run i with run i + 1
+static node_t* link_prev(node_t* p_head);                           // Set the prev pointers of the chain after p_head, return its last node
+static void sort_segment_task(void* p_task);                         // Sort and mark one segment of parallel_sort()
+static void merge_round(struct parallel_sort* p_sort, struct sort_task* p_tasks, int nr_runs, int nr_threads); // Merge the runs of parallel_sort() pairwise
+static void split_task(void* p_task);                               // Find the start of a part of a merge in both runs
+static void merge_part_task(void* p_task);                          // Merge one part of two runs
+static len_t split_rank(struct sort_segment* p_run1, struct sort_segment* p_run2, len_t rank); // Nodes of p_run1 among the first rank merged nodes
+static node_t* run_node(struct sort_segment* p_run, len_t position); // Node at a position of a marked run
+static node_t* merge_marked(node_t* p_head, node_t* p_node_1, len_t nr_nodes_1, node_t* p_node_2, len_t nr_nodes_2, node_t** p_marks, len_t rank); // Merge counted chains and mark them
+static len_t part_rank(len_t total, int part, int nr_parts);        // First rank of a part of a merge
+static node_t* split_run(node_t* p_first, len_t run_length);        // Cut a run off a chain of nodes
+static node_t* merge(node_t* p_run1, node_t* p_run2);              // Merge two sorted chains, return the first node
+static node_t* take_chain(list_t* p_dest_list, list_t* p_src_list); // Detach the nodes of p_src_list into the pool of p_dest_list
+static int heap_less(const struct heap_entry* p_entry_1, const struct heap_entry* p_entry_2); // Order of the heap entries
+static void heap_sift_down(struct heap_entry* p_heap, int nr_entries, int i); // Restore the heap below entry i
+static node_t* radix_pass(node_t* p_head, int shift);               // Stable distribution of the chain after p_head by one byte, return its last node
+static void index_after_insert(list_t* p_list, node_t* p_prev, node_t* p_new_node); // Update the hash index after an insert
+static void index_after_delete(list_t* p_list, node_t* p_prev, node_t* p_delete_node); // Update the hash index after a delete
+static void index_append_chain(list_t* p_list, node_t* p_prev);     // Add the nodes after p_prev to the hash index
+static void order_label(list_t* p_list, node_t* p_prev, node_t* p_new_node); // Label a node inserted after p_prev
+static void order_spread(list_t* p_list, node_t* p_prev);           // Relabel the nodes after p_prev over a range with room for them
+static void order_relabel(list_t* p_list);                          // Label every node again with even gaps
+void* xcalloc(int nr_of_elemet, len_t size_per_element);             // Helper function to allocate memory
+
+#endif /*_LIST_H*/
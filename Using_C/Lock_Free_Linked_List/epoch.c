@@ -0,0 +1,191 @@
+/**
+ * @file epoch.c
+ * @author Akash_Thorat
+ * @brief Implementation of the epoch based memory reclamation of the lock free list.
+ * @version 0.1
+ * @date 2024-05-06
+ *
+ * This file contains the implementation of the epoch based reclamation. Records
+ * of the threads are kept on a registry to which records are only ever added, so
+ * it can be walked without any lock. A pointer retired while its thread observed
+ * epoch e goes to bucket e % 3, which is freed the next time that thread enters
+ * an epoch equal to e modulo 3, at least 3 epochs later. The global epoch only
+ * advances when every active thread observed the current one, so at that time no
+ * thread can be inside an operation which started before the pointer was retired.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (epoch.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "list.h"
+#include "epoch.h"
+
+static atomic_uint global_epoch = 0;                         // Current global epoch
+static _Atomic(epoch_record_t*) p_registry = NULL;           // Records of all threads
+static _Thread_local epoch_record_t* p_thread_record = NULL; // Record of the calling thread
+static pthread_key_t record_key;                             // Gives the record back when a thread exits
+static pthread_once_t record_key_once = PTHREAD_ONCE_INIT;
+
+static void epoch_create_key(void)
+{
+    pthread_key_create(&record_key, epoch_release_record);
+}
+
+// Start of an operation, the calling thread observes the global epoch
+void epoch_enter(void)
+{
+    epoch_record_t* p_record = NULL;
+    unsigned int epoch = 0;
+
+    p_record = epoch_get_record();
+    p_record->nesting = p_record->nesting + 1;
+    if (p_record->nesting > 1)
+        return;
+
+    atomic_store(&p_record->active, 1);
+    epoch = atomic_load(&global_epoch);
+    if (atomic_load(&p_record->epoch) != epoch)
+    {
+        atomic_store(&p_record->epoch, epoch);
+        // Pointers of this bucket were retired at least 3 epochs ago
+        epoch_free_bucket(&p_record->buckets[epoch % EPOCH_NR_BUCKETS]);
+    }
+}
+
+// End of an operation of the calling thread
+void epoch_exit(void)
+{
+    epoch_record_t* p_record = NULL;
+
+    p_record = epoch_get_record();
+    p_record->nesting = p_record->nesting - 1;
+    // Release is enough, the reads of the operation may not move after this store
+    if (p_record->nesting == 0)
+        atomic_store_explicit(&p_record->active, 0, memory_order_release);
+}
+
+// Free p once no thread can hold it anymore, must be called inside an operation
+void epoch_retire(void* p)
+{
+    epoch_retire_to(p, NULL, NULL);
+}
+
+// Call reclaim(p, p_ctx) once no thread can hold p anymore, must be called inside an operation
+void epoch_retire_to(void* p, epoch_reclaim_t reclaim, void* p_ctx)
+{
+    epoch_record_t* p_record = NULL;
+    epoch_bucket_t* p_bucket = NULL;
+    epoch_item_t* p_item = NULL;
+
+    p_record = epoch_get_record();
+    p_bucket = &p_record->buckets[atomic_load(&p_record->epoch) % EPOCH_NR_BUCKETS];
+    if (p_bucket->nr_items == p_bucket->capacity)
+    {
+        p_bucket->capacity = (p_bucket->capacity == 0) ? EPOCH_RETIRE_THRESHOLD : 2 * p_bucket->capacity;
+        p_bucket->p_items = (epoch_item_t*) realloc(p_bucket->p_items, p_bucket->capacity * sizeof(epoch_item_t));
+        if (p_bucket->p_items == NULL)
+        {
+            puts("ERROR while allocating memory ..!");
+            exit(EXIT_FAILURE);
+        }
+    }
+    p_item = &p_bucket->p_items[p_bucket->nr_items];
+    p_item->p = p;
+    p_item->reclaim = reclaim;
+    p_item->p_ctx = p_ctx;
+    p_bucket->nr_items = p_bucket->nr_items + 1;
+
+    if (p_bucket->nr_items % EPOCH_RETIRE_THRESHOLD == 0)
+        epoch_try_advance();
+}
+
+// Reclaim every retired pointer of every thread, no thread may be inside an operation
+void epoch_drain(void)
+{
+    epoch_record_t* p_record = NULL;
+
+    for (p_record = atomic_load(&p_registry); p_record != NULL; p_record = p_record->p_next)
+        for (int i = 0; i < EPOCH_NR_BUCKETS; ++i)
+            epoch_free_bucket(&p_record->buckets[i]);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Get the record of the calling thread, a free record is reused or a new one is added
+static epoch_record_t* epoch_get_record(void)
+{
+    epoch_record_t* p_record = NULL;
+    epoch_record_t* p_head = NULL;
+    int expected = 0;
+
+    if (p_thread_record != NULL)
+        return (p_thread_record);
+
+    pthread_once(&record_key_once, epoch_create_key);
+
+    for (p_record = atomic_load(&p_registry); p_record != NULL; p_record = p_record->p_next)
+    {
+        expected = 0;
+        if (atomic_compare_exchange_strong(&p_record->in_use, &expected, 1))
+            break;
+    }
+
+    if (p_record == NULL)
+    {
+        p_record = (epoch_record_t*) xcalloc(1, sizeof(epoch_record_t));
+        atomic_store(&p_record->in_use, 1);
+        atomic_store(&p_record->epoch, atomic_load(&global_epoch));
+        p_head = atomic_load(&p_registry);
+        do
+        {
+            p_record->p_next = p_head;
+        } while (!atomic_compare_exchange_weak(&p_registry, &p_head, p_record));
+    }
+
+    p_record->nesting = 0;
+    p_thread_record = p_record;
+    pthread_setspecific(record_key, p_record);
+    return (p_record);
+}
+
+// Advance the global epoch if every active thread observed the current one
+static void epoch_try_advance(void)
+{
+    epoch_record_t* p_record = NULL;
+    unsigned int epoch = 0;
+
+    epoch = atomic_load(&global_epoch);
+    for (p_record = atomic_load(&p_registry); p_record != NULL; p_record = p_record->p_next)
+    {
+        if (atomic_load(&p_record->in_use) && atomic_load(&p_record->active) &&
+            atomic_load(&p_record->epoch) != epoch)
+            return;
+    }
+    atomic_compare_exchange_strong(&global_epoch, &epoch, epoch + 1);
+}
+
+// Reclaim the pointers of a bucket
+static void epoch_free_bucket(epoch_bucket_t* p_bucket)
+{
+    epoch_item_t* p_item = NULL;
+
+    for (int i = 0; i < p_bucket->nr_items; ++i)
+    {
+        p_item = &p_bucket->p_items[i];
+        if (p_item->reclaim != NULL)
+            p_item->reclaim(p_item->p, p_item->p_ctx);
+        else
+            free(p_item->p);
+    }
+    p_bucket->nr_items = 0;
+}
+
+// Give the record of an exiting thread back, its retired pointers are freed by the next owner
+static void epoch_release_record(void* p_record)
+{
+    atomic_store(&((epoch_record_t*) p_record)->active, 0);
+    atomic_store(&((epoch_record_t*) p_record)->in_use, 0);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file epoch.h
+ * @author Akash_Thorat
+ * @brief Header file declaring the epoch based memory reclamation of the lock free list.
+ * @version 0.1
+ * @date 2024-05-06
+ *
+ * This header file contains the declarations for the epoch based reclamation used
+ * by the lock free linked list. A node unlinked by one thread may still be read by
+ * other threads which reached it before it was unlinked, so it can not be freed
+ * right away. Every list operation runs between epoch_enter() and epoch_exit(),
+ * unlinked nodes are given to epoch_retire(), and a retired node is freed only
+ * after the global epoch advanced twice, when no thread can still hold it.
+ *
+ * Every thread gets a record on its first operation, the record is given back
+ * when the thread exits and reused by the next new thread.
+ *
+ * A retired pointer is freed with free() by default, epoch_retire_to() hands it
+ * to a routine of the caller instead, e.g. to recycle queue nodes (see queue.c).
+ */
+
+#ifndef _EPOCH_H
+#define _EPOCH_H
+
+#include <stdatomic.h>
+
+#define EPOCH_NR_BUCKETS 3           // Retired pointers are kept per epoch modulo 3
+#define EPOCH_RETIRE_THRESHOLD 64    // Number of retired pointers after which the epoch is advanced
+
+typedef void (*epoch_reclaim_t)(void* p, void* p_ctx);  // Typedef for the routine reclaiming a retired pointer
+
+// Define a retired pointer
+struct epoch_item {
+    void* p;                         // Retired pointer
+    epoch_reclaim_t reclaim;         // Routine reclaiming p, NULL for free()
+    void* p_ctx;                     // Context passed to reclaim
+};
+
+// Define the pointers retired during one epoch
+struct epoch_bucket {
+    struct epoch_item* p_items;      // Retired pointers
+    int nr_items;                    // Number of retired pointers
+    int capacity;                    // Number of slots of p_items
+};
+
+// Define the record of a thread
+struct epoch_record {
+    atomic_uint epoch;               // Epoch observed by the thread when it entered
+    atomic_int active;               // Non zero while the thread is inside an operation
+    atomic_int in_use;               // Non zero while the record belongs to a thread
+    int nesting;                     // Depth of nested epoch_enter() calls
+    struct epoch_bucket buckets[EPOCH_NR_BUCKETS]; // Pointers retired by the thread
+    struct epoch_record* p_next;     // Next record of the registry
+};
+
+typedef struct epoch_item epoch_item_t;       // Typedef for retired pointer structure
+typedef struct epoch_bucket epoch_bucket_t;   // Typedef for bucket structure
+typedef struct epoch_record epoch_record_t;   // Typedef for record structure
+
+// Function prototypes for the operations of the reclamation
+void epoch_enter(void);                      // Start of an operation of the calling thread
+void epoch_exit(void);                       // End of an operation of the calling thread
+void epoch_retire(void* p);                  // Free p once no thread can hold it anymore
+void epoch_retire_to(void* p, epoch_reclaim_t reclaim, void* p_ctx); // Call reclaim(p, p_ctx) once no thread can hold p anymore
+void epoch_drain(void);                      // Reclaim every retired pointer, no operation may be running
+
+// Helper routines used internally by the interface functions
+static epoch_record_t* epoch_get_record(void);                // Get the record of the calling thread
+static void epoch_try_advance(void);                          // Advance the global epoch if every active thread observed it
+static void epoch_free_bucket(epoch_bucket_t* p_bucket);      // Reclaim the pointers of a bucket
+static void epoch_release_record(void* p_record);             // Give the record of an exiting thread back
+
+#endif /*_EPOCH_H*/
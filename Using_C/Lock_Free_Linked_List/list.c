@@ -0,0 +1,276 @@
+/**
+ * @file list.c
+ * @author Akash_Thorat
+ * @brief Implementation of a lock free linked list keeping an ordered set.
+ * @version 0.1
+ * @date 2024-05-06
+ *
+ * This file contains the implementation of the lock free linked list. Every link
+ * is an atomic word holding the address of the next node, its low bit is set when
+ * the node owning the link is deleted. A compare and swap on a link fails when the
+ * link changed or when its node got deleted meanwhile, so a node is never inserted
+ * after a deleted node and a deleted node is never unlinked twice.
+ *
+ * search_position() walks the list and unlinks the deleted nodes it meets. Only
+ * the thread whose compare and swap unlinked a node retires it, so every node is
+ * given to the epoch based reclamation (epoch.c) exactly once. search_data() only
+ * reads the list and never retries.
+ *
+ * This file serves as the backend implementation for the linked list data structure
+ * and is intended to be used in conjunction with the corresponding header file (list.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "epoch.h"
+
+// Function to create a new list with a dummy node
+list_t* create_list(void)
+{
+    list_t* p_list = NULL;
+
+    p_list = (list_t*) xcalloc(1, sizeof(list_t));
+    p_list->head.data = -1;
+    atomic_init(&p_list->head.next, (uintptr_t) NULL);
+
+    return (p_list);
+}
+
+// Insert data at its sorted position, LIST_DATA_EXISTS if it is already in the list
+status_t insert(list_t* p_list, data_t new_data)
+{
+    _Atomic(uintptr_t)* p_prev_link = NULL;
+    node_t* p_node = NULL;
+    node_t* p_new_node = NULL;
+    uintptr_t expected = 0;
+    status_t status = SUCCESS;
+
+    epoch_enter();
+    while (1)
+    {
+        p_node = search_position(p_list, new_data, &p_prev_link);
+        if (p_node != NULL && p_node->data == new_data)
+        {
+            status = LIST_DATA_EXISTS;
+            break;
+        }
+
+        if (p_new_node == NULL)
+            p_new_node = get_new_node(new_data);
+        atomic_store(&p_new_node->next, (uintptr_t) p_node);
+
+        // Fails if the predecessor got another successor or got deleted
+        expected = (uintptr_t) p_node;
+        if (atomic_compare_exchange_strong(p_prev_link, &expected, (uintptr_t) p_new_node))
+        {
+            p_new_node = NULL;
+            break;
+        }
+    }
+    epoch_exit();
+
+    // The node was never published, no other thread can hold it
+    free(p_new_node);
+    return (status);
+}
+
+// Remove a specific value from the list
+status_t remove_data(list_t* p_list, data_t r_data)
+{
+    _Atomic(uintptr_t)* p_prev_link = NULL;
+    node_t* p_node = NULL;
+    uintptr_t next_link = 0;
+    uintptr_t expected = 0;
+    status_t status = SUCCESS;
+
+    epoch_enter();
+    while (1)
+    {
+        p_node = search_position(p_list, r_data, &p_prev_link);
+        if (p_node == NULL || p_node->data != r_data)
+        {
+            status = LIST_DATA_NOT_FOUND;
+            break;
+        }
+
+        // Logical delete, the thread which sets the mark owns the removal
+        next_link = atomic_load(&p_node->next);
+        if (is_marked(next_link))
+            continue;
+        if (!atomic_compare_exchange_strong(&p_node->next, &next_link, next_link | 1))
+            continue;
+
+        // Physical delete, left to the next search if the predecessor changed
+        expected = (uintptr_t) p_node;
+        if (atomic_compare_exchange_strong(p_prev_link, &expected, next_link))
+            epoch_retire(p_node);
+        else
+            search_position(p_list, r_data, &p_prev_link);
+        break;
+    }
+    epoch_exit();
+
+    return (status);
+}
+
+// Search for a specific value in the list, returns non zero if found
+int search_data(list_t* p_list, data_t f_data)
+{
+    node_t* p_run = NULL;
+    int found = 0;
+
+    epoch_enter();
+    p_run = get_node(atomic_load(&p_list->head.next));
+    while (p_run != NULL && p_run->data < f_data)
+        p_run = get_node(atomic_load(&p_run->next));
+    found = (p_run != NULL && p_run->data == f_data && !is_marked(atomic_load(&p_run->next)));
+    epoch_exit();
+
+    return (found);
+}
+
+// Get the smallest element of the list
+status_t get_start(list_t* p_list, data_t* p_start_data)
+{
+    node_t* p_run = NULL;
+    status_t status = LIST_EMPTY;
+
+    epoch_enter();
+    for (p_run = get_node(atomic_load(&p_list->head.next)); p_run != NULL; p_run = get_node(atomic_load(&p_run->next)))
+    {
+        if (!is_marked(atomic_load(&p_run->next)))
+        {
+            *p_start_data = p_run->data;
+            status = SUCCESS;
+            break;
+        }
+    }
+    epoch_exit();
+
+    return (status);
+}
+
+// Check if the list is empty
+int is_list_empty(list_t* p_list)
+{
+    data_t data = 0;
+    return (get_start(p_list, &data) == LIST_EMPTY);
+}
+
+// Get the size/length of the list, counting the nodes which are not deleted
+len_t size(list_t* p_list)
+{
+    node_t* p_run = NULL;
+    len_t length = 0;
+
+    epoch_enter();
+    for (p_run = get_node(atomic_load(&p_list->head.next)); p_run != NULL; p_run = get_node(atomic_load(&p_run->next)))
+        if (!is_marked(atomic_load(&p_run->next)))
+            ++length;
+    epoch_exit();
+
+    return (length);
+}
+
+// Display the contents of the list
+void show(list_t* p_list, const char* msg)
+{
+    node_t* p_run = NULL;
+    if (msg)
+        puts(msg);
+    printf("[START]->");
+    epoch_enter();
+    for (p_run = get_node(atomic_load(&p_list->head.next)); p_run != NULL; p_run = get_node(atomic_load(&p_run->next)))
+        if (!is_marked(atomic_load(&p_run->next)))
+            printf("[%d]->", p_run->data);
+    epoch_exit();
+    puts("[END]");
+}
+
+// Destroy the list and free memory, nodes already retired are left to the reclamation
+status_t destroy_list(list_t** pp_list)
+{
+    node_t* p_run = NULL;
+    node_t* p_run_next = NULL;
+
+    for (p_run = get_node(atomic_load(&(*pp_list)->head.next)); p_run != NULL; p_run = p_run_next)
+    {
+        p_run_next = get_node(atomic_load(&p_run->next));
+        free(p_run);
+    }
+    free(*pp_list);
+    *pp_list = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Find the first node not smaller than key and the link pointing to it, deleted nodes on the way are unlinked
+static node_t* search_position(list_t* p_list, data_t key, _Atomic(uintptr_t)** pp_prev_link)
+{
+    _Atomic(uintptr_t)* p_prev_link = NULL;
+    node_t* p_node = NULL;
+    uintptr_t next_link = 0;
+    uintptr_t expected = 0;
+
+retry:
+    p_prev_link = &p_list->head.next;
+    p_node = get_node(atomic_load(p_prev_link));
+    while (p_node != NULL)
+    {
+        next_link = atomic_load(&p_node->next);
+        if (is_marked(next_link))
+        {
+            // Fails if the predecessor got deleted too, the walk is started again
+            expected = (uintptr_t) p_node;
+            if (!atomic_compare_exchange_strong(p_prev_link, &expected, next_link & ~(uintptr_t) 1))
+                goto retry;
+            epoch_retire(p_node);
+            p_node = get_node(next_link);
+            continue;
+        }
+        if (p_node->data >= key)
+            break;
+        p_prev_link = &p_node->next;
+        p_node = get_node(next_link);
+    }
+
+    *pp_prev_link = p_prev_link;
+    return (p_node);
+}
+
+// Create a new node with given data
+static node_t* get_new_node(data_t new_data)
+{
+    node_t* p_new_node = NULL;
+    p_new_node = (node_t*) xcalloc(1, sizeof(node_t));
+    p_new_node->data = new_data;
+    atomic_init(&p_new_node->next, (uintptr_t) NULL);
+    return (p_new_node);
+}
+
+// Check if a link belongs to a deleted node
+static int is_marked(uintptr_t link)
+{
+    return ((int) (link & 1));
+}
+
+// Get the node a link points to, without the mark
+static node_t* get_node(uintptr_t link)
+{
+    return ((node_t*) (link & ~(uintptr_t) 1));
+}
+
+// Helper function to allocate memory
+void* xcalloc(int nr_of_element, len_t size_per_element)
+{
+    void* p = NULL;
+    p = calloc(nr_of_element, size_per_element);
+    if (p == NULL)
+    {
+        puts("ERROR while allocating memory ..!");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file list.h
+ * @author Akash_Thorat
+ * @brief Header file defining a lock free linked list keeping an ordered set.
+ * @version 0.1
+ * @date 2024-05-06
+ *
+ * This header file contains the declarations for a lock free singly linked list,
+ * after the list of Harris with the single node unlinking of Michael. The list
+ * keeps its elements sorted in ascending order without duplicates, insert(),
+ * remove_data() and search_data() may be called from any number of threads at
+ * the same time without any lock.
+ *
+ * A node is removed in two steps. The low bit of its next pointer is set first,
+ * which logically deletes the node and freezes its link, then the node is
+ * unlinked from its predecessor with a compare and swap. Any operation which
+ * meets a marked node while walking the list helps to unlink it. Unlinked nodes
+ * are freed through the epoch based reclamation of epoch.h.
+ *
+ * It should be used in conjunction with the corresponding source files (list.c
+ * and epoch.c) and linked with -lpthread.
+ */
+
+
+#ifndef _LIST_H
+#define _LIST_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+// Define the structure of a node in the linked list
+struct node {
+    int data;                    // Data stored in the node
+    _Atomic(uintptr_t) next;     // Pointer to the next node, low bit set when this node is deleted
+};
+
+// Define the header of the linked list, kept separate from the nodes
+struct list {
+    struct node head;            // Dummy node, head.next is the first node of the list
+};
+
+// Define typedefs for clarity and abstraction
+typedef enum status {SUCCESS = 1, LIST_EMPTY, LIST_DATA_NOT_FOUND, LIST_DATA_EXISTS} status_t;  // Status codes for list operations
+typedef struct node node_t;  // Typedef for node structure
+typedef struct list list_t;   // Typedef for the entire linked list
+typedef int data_t;           // Typedef for data stored in nodes
+typedef int len_t;            // Typedef for length/size of the list
+
+// Function prototypes for the operations that can be performed on the list, all of them are thread safe
+list_t* create_list(void);                                  // Create a new linked list
+status_t insert(list_t* p_list, data_t new_data);           // Insert data at its sorted position, unless it is already there
+status_t remove_data(list_t* p_list, data_t r_data);         // Remove a specific value from the list
+int search_data(list_t* p_list, data_t f_data);             // Search for a specific value in the list
+status_t get_start(list_t* p_list, data_t* p_start_data);   // Get the smallest element of the list
+
+int is_list_empty(list_t* p_list);                          // Check if the list is empty
+len_t size(list_t* p_list);                                 // Get the size/length of the list, exact only without concurrent updates
+void show(list_t* p_list, const char* msg);                  // Display the contents of the list
+status_t destroy_list(list_t** pp_list);                    // Destroy the list and free memory, no other thread may use the list
+
+
+// Helper routines used internally by the interface functions
+static node_t* search_position(list_t* p_list, data_t key, _Atomic(uintptr_t)** pp_prev_link); // Find the first node not smaller than key, unlinking deleted nodes
+static node_t* get_new_node(data_t new_data);                       // Create a new node with given data
+static int is_marked(uintptr_t link);                               // Check if a link belongs to a deleted node
+static node_t* get_node(uintptr_t link);                            // Get the node a link points to
+void* xcalloc(int nr_of_elemet, len_t size_per_element);             // Helper function to allocate memory
+
+#endif /*_LIST_H*/
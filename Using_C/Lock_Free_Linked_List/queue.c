@@ -0,0 +1,207 @@
+/**
+ * @file queue.c
+ * @author Akash_Thorat
+ * @brief Implementation of a lock free FIFO queue for many producers and consumers.
+ * @version 0.1
+ * @date 2024-05-09
+ *
+ * This file contains the implementation of the queue of Michael and Scott. Every
+ * operation runs between epoch_enter() and epoch_exit(), so a node read by one
+ * thread can not be recycled by another one meanwhile.
+ *
+ * The free stack of the pool is popped with a compare and swap on its top. A pop
+ * can only be fooled if the top node is popped and pushed back while the popping
+ * thread is inside its operation, but nodes are pushed back only once the epoch
+ * advanced twice, which can not happen while that thread is inside its operation.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (queue.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+#include "queue.h"
+#include "epoch.h"
+
+// Create a new queue holding only its dummy node
+queue_t* create_queue(void)
+{
+    queue_t* p_queue = NULL;
+    queue_node_t* p_dummy = NULL;
+
+    p_queue = (queue_t*) xcalloc(1, sizeof(queue_t));
+    atomic_init(&p_queue->p_free, NULL);
+    atomic_init(&p_queue->p_slabs, NULL);
+
+    p_dummy = queue_alloc_node(p_queue);
+    atomic_store(&p_dummy->next, NULL);
+    atomic_init(&p_queue->p_head, p_dummy);
+    atomic_init(&p_queue->p_tail, p_dummy);
+
+    return (p_queue);
+}
+
+// Add data at the end of the queue
+status_t enqueue(queue_t* p_queue, data_t new_data)
+{
+    queue_node_t* p_new_node = NULL;
+    queue_node_t* p_tail = NULL;
+    queue_node_t* p_next = NULL;
+
+    epoch_enter();
+    p_new_node = queue_alloc_node(p_queue);
+    p_new_node->data = new_data;
+    atomic_store(&p_new_node->next, NULL);
+
+    while (1)
+    {
+        p_tail = atomic_load(&p_queue->p_tail);
+        p_next = atomic_load(&p_tail->next);
+        if (p_tail != atomic_load(&p_queue->p_tail))
+            continue;
+        if (p_next != NULL)
+        {
+            // Tail is lagging behind, help to move it forward
+            atomic_compare_exchange_strong(&p_queue->p_tail, &p_tail, p_next);
+            continue;
+        }
+        if (atomic_compare_exchange_strong(&p_tail->next, &p_next, p_new_node))
+            break;
+    }
+    // Fails harmlessly if another thread already moved the tail
+    atomic_compare_exchange_strong(&p_queue->p_tail, &p_tail, p_new_node);
+    epoch_exit();
+
+    return (SUCCESS);
+}
+
+// Remove the first element, waiting until an element is enqueued if the queue is empty
+status_t dequeue(queue_t* p_queue, data_t* p_data)
+{
+    while (try_dequeue(p_queue, p_data) == LIST_EMPTY)
+        sched_yield();
+    return (SUCCESS);
+}
+
+// Remove the first element, LIST_EMPTY if the queue is empty
+status_t try_dequeue(queue_t* p_queue, data_t* p_data)
+{
+    queue_node_t* p_head = NULL;
+    queue_node_t* p_tail = NULL;
+    queue_node_t* p_next = NULL;
+    data_t data = 0;
+    status_t status = SUCCESS;
+
+    epoch_enter();
+    while (1)
+    {
+        p_head = atomic_load(&p_queue->p_head);
+        p_tail = atomic_load(&p_queue->p_tail);
+        p_next = atomic_load(&p_head->next);
+        if (p_head != atomic_load(&p_queue->p_head))
+            continue;
+        if (p_head == p_tail)
+        {
+            if (p_next == NULL)
+            {
+                status = LIST_EMPTY;
+                break;
+            }
+            // Tail is lagging behind, help to move it forward
+            atomic_compare_exchange_strong(&p_queue->p_tail, &p_tail, p_next);
+            continue;
+        }
+        // Read before the swap, afterwards another consumer may dequeue p_next
+        data = p_next->data;
+        if (atomic_compare_exchange_strong(&p_queue->p_head, &p_head, p_next))
+        {
+            *p_data = data;
+            epoch_retire_to(p_head, queue_recycle_node, p_queue);
+            break;
+        }
+    }
+    epoch_exit();
+
+    return (status);
+}
+
+// Check if the queue is empty
+int is_queue_empty(queue_t* p_queue)
+{
+    queue_node_t* p_head = NULL;
+    int empty = 0;
+
+    epoch_enter();
+    p_head = atomic_load(&p_queue->p_head);
+    empty = (atomic_load(&p_head->next) == NULL);
+    epoch_exit();
+
+    return (empty);
+}
+
+// Destroy the queue and release its slabs, no thread may be inside an operation of the lock free structures
+status_t destroy_queue(queue_t** pp_queue)
+{
+    queue_slab_t* p_slab = NULL;
+    queue_slab_t* p_slab_next = NULL;
+
+    // Retired nodes of the queue must be recycled before their slabs go away
+    epoch_drain();
+
+    for (p_slab = atomic_load(&(*pp_queue)->p_slabs); p_slab != NULL; p_slab = p_slab_next)
+    {
+        p_slab_next = p_slab->p_next;
+        free(p_slab);
+    }
+    free(*pp_queue);
+    *pp_queue = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Get a node from the free stack, a new slab is added when the stack is empty
+static queue_node_t* queue_alloc_node(queue_t* p_queue)
+{
+    queue_node_t* p_node = NULL;
+    queue_node_t* p_next = NULL;
+    queue_slab_t* p_slab = NULL;
+
+    p_node = atomic_load(&p_queue->p_free);
+    while (p_node != NULL)
+    {
+        p_next = atomic_load(&p_node->next);
+        if (atomic_compare_exchange_weak(&p_queue->p_free, &p_node, p_next))
+            return (p_node);
+    }
+
+    p_slab = (queue_slab_t*) xcalloc(1, sizeof(queue_slab_t));
+    p_slab->p_next = atomic_load(&p_queue->p_slabs);
+    while (!atomic_compare_exchange_weak(&p_queue->p_slabs, &p_slab->p_next, p_slab))
+        ;
+
+    // First node is handed out, the others go on the free stack
+    for (int i = 1; i < QUEUE_SLAB_NODES - 1; ++i)
+        atomic_init(&p_slab->nodes[i].next, &p_slab->nodes[i + 1]);
+    queue_push_chain(p_queue, &p_slab->nodes[1], &p_slab->nodes[QUEUE_SLAB_NODES - 1]);
+    return (&p_slab->nodes[0]);
+}
+
+// Push a node back on the free stack, called by the reclamation once no thread can hold it
+static void queue_recycle_node(void* p_node, void* p_queue)
+{
+    queue_push_chain((queue_t*) p_queue, (queue_node_t*) p_node, (queue_node_t*) p_node);
+}
+
+// Push the chain of nodes p_first ... p_last on the free stack
+static void queue_push_chain(queue_t* p_queue, queue_node_t* p_first, queue_node_t* p_last)
+{
+    queue_node_t* p_top = NULL;
+
+    p_top = atomic_load(&p_queue->p_free);
+    do
+    {
+        atomic_store(&p_last->next, p_top);
+    } while (!atomic_compare_exchange_weak(&p_queue->p_free, &p_top, p_first));
+}
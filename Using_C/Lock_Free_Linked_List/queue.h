@@ -0,0 +1,68 @@
+/**
+ * @file queue.h
+ * @author Akash_Thorat
+ * @brief Header file defining a lock free FIFO queue for many producers and consumers.
+ * @version 0.1
+ * @date 2024-05-09
+ *
+ * This header file contains the declarations for the queue of Michael and Scott,
+ * the lock free counterpart of a list used through insert_end() and pop_start().
+ * The queue is a singly linked list which always starts with a dummy node. An
+ * element is enqueued by linking a new node after the last one with a compare and
+ * swap, it is dequeued by moving the head to the next node, which becomes the new
+ * dummy. Threads which find the tail lagging behind help to move it forward.
+ *
+ * Nodes come from a pool private to the queue. The old dummy of a dequeue goes
+ * back to the pool through the epoch based reclamation of epoch.h, so a node is
+ * reused only when no thread can still read it, which also protects the free
+ * stack of the pool from the ABA problem. The pool grows by slabs of nodes which
+ * are released by destroy_queue().
+ */
+
+#ifndef _QUEUE_H
+#define _QUEUE_H
+
+#include <stdatomic.h>
+#include "list.h"
+
+#define QUEUE_SLAB_NODES 256         // Number of nodes allocated at once when the pool is empty
+#define QUEUE_CACHE_LINE 64          // Head and tail are kept on separate cache lines
+
+// Define the structure of a node in the queue
+struct queue_node {
+    data_t data;                             // Data stored in the node
+    _Atomic(struct queue_node*) next;        // Pointer to the next node of the queue, or of the free stack
+};
+
+// Define a slab of nodes of the pool
+struct queue_slab {
+    struct queue_slab* p_next;               // Pointer to the next slab of the pool
+    struct queue_node nodes[QUEUE_SLAB_NODES]; // Nodes carved from this slab
+};
+
+// Define the structure of the queue
+struct queue {
+    _Alignas(QUEUE_CACHE_LINE) _Atomic(struct queue_node*) p_head;  // Dummy node, the first element follows it
+    _Alignas(QUEUE_CACHE_LINE) _Atomic(struct queue_node*) p_tail;  // Last node, or a node close to it
+    _Alignas(QUEUE_CACHE_LINE) _Atomic(struct queue_node*) p_free;  // Free stack of recycled nodes
+    _Atomic(struct queue_slab*) p_slabs;     // Slabs owned by the queue
+};
+
+typedef struct queue_node queue_node_t;  // Typedef for node structure
+typedef struct queue_slab queue_slab_t;  // Typedef for slab structure
+typedef struct queue queue_t;            // Typedef for queue structure
+
+// Function prototypes for the operations that can be performed on the queue, all of them are thread safe
+queue_t* create_queue(void);                                  // Create a new empty queue
+status_t enqueue(queue_t* p_queue, data_t new_data);          // Add data at the end of the queue
+status_t dequeue(queue_t* p_queue, data_t* p_data);           // Remove the first element, waiting until there is one
+status_t try_dequeue(queue_t* p_queue, data_t* p_data);       // Remove the first element, LIST_EMPTY if there is none
+int is_queue_empty(queue_t* p_queue);                         // Check if the queue is empty
+status_t destroy_queue(queue_t** pp_queue);                   // Destroy the queue, no thread may be inside an operation
+
+// Helper routines used internally by the interface functions
+static queue_node_t* queue_alloc_node(queue_t* p_queue);     // Get a node from the pool of the queue
+static void queue_recycle_node(void* p_node, void* p_queue); // Push a node back on the free stack of the queue
+static void queue_push_chain(queue_t* p_queue, queue_node_t* p_first, queue_node_t* p_last); // Push a chain of nodes on the free stack
+
+#endif /*_QUEUE_H*/
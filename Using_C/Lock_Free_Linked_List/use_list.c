@@ -0,0 +1,198 @@
+/**
+ * @file use_list.c
+ * @author Akash_Thorat
+ * @brief A program to demonstrate the usage of the lock free linked list implementation.
+ * @version 0.1
+ * @date 2024-05-06
+ *
+ * This program demonstrates the operations of the lock free linked list, first
+ * from a single thread, then from several threads which insert, search and remove
+ * overlapping ranges of values at the same time. It verifies the functionality of
+ * the implementation provided in the "list.h" header file.
+ *
+ * The lock free queue of "queue.h" is exercised the same way, producers and
+ * consumers exchange values and every value must be dequeued exactly once.
+ *
+ * Finally, it destroys the list and the queue and frees the memory.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+#include "list.h"
+#include "queue.h"
+#include "epoch.h"
+
+#define NR_THREADS 4
+#define NR_VALUES 2000
+
+// Define the argument of a worker thread
+struct worker_arg {
+    list_t* p_list;      // List shared by the threads
+    int id;              // Number of the thread
+    pthread_barrier_t* p_barrier; // Separates the insertions from the removals
+};
+
+// Work of one producer, it enqueues NR_VALUES values
+static void* producer(void* p_arg)
+{
+    for (int i = 0; i < NR_VALUES; ++i)
+        assert(SUCCESS == enqueue((queue_t*) p_arg, i));
+    return (NULL);
+}
+
+// Work of one consumer, it dequeues NR_VALUES values and returns their sum
+static void* consumer(void* p_arg)
+{
+    data_t data = 0;
+    long sum = 0;
+
+    for (int i = 0; i < NR_VALUES; ++i)
+    {
+        assert(SUCCESS == dequeue((queue_t*) p_arg, &data));
+        sum = sum + data;
+    }
+    return ((void*) sum);
+}
+
+// Work of one thread, every thread inserts all values and removes its share of them
+static void* worker(void* p_arg)
+{
+    list_t* p_list = NULL;
+    int id = 0;
+
+    p_list = ((struct worker_arg*) p_arg)->p_list;
+    id = ((struct worker_arg*) p_arg)->id;
+
+    for (int i = 0; i < NR_VALUES; ++i)
+        insert(p_list, i);
+    pthread_barrier_wait(((struct worker_arg*) p_arg)->p_barrier);
+    for (int i = id; i < NR_VALUES; i += NR_THREADS)
+        if (i % 2 == 1)
+            assert(SUCCESS == remove_data(p_list, i));
+    for (int i = 0; i < NR_VALUES; i += 2)
+        assert(search_data(p_list, i));
+
+    return (NULL);
+}
+
+int main(void)
+{
+    list_t* l1 = NULL;
+    pthread_t threads[NR_THREADS];
+    struct worker_arg args[NR_THREADS];
+    pthread_barrier_t barrier;
+    queue_t* q1 = NULL;
+    void* p_sum = NULL;
+    long sum = 0;
+
+    data_t data = 0;
+
+    // Start of the program
+    puts("PROGRAM START");
+
+
+    //----------------------------- single thread ------------------------------
+    // Create an empty list l1
+    l1 = create_list();
+
+    // Assertions to verify the initial state of the list l1
+    assert(l1 != NULL);
+    assert(is_list_empty(l1));
+    assert(LIST_EMPTY == get_start(l1, &data));
+    assert(LIST_DATA_NOT_FOUND == remove_data(l1, 10));
+    assert(0 == size(l1));
+
+    // Insert 20 random elements, the list keeps them sorted and unique
+    for (int i = 0; i < 20; ++i)
+        insert(l1, rand() % 50);
+    show(l1, "After insert 20 random elements in l1 : ");
+    printf("length of list l1 = %d\n", size(l1));
+
+    assert(SUCCESS == insert(l1, 100));
+    assert(LIST_DATA_EXISTS == insert(l1, 100));
+    assert(SUCCESS == insert(l1, -5));
+    assert(SUCCESS == get_start(l1, &data));
+    assert(-5 == data);
+    show(l1, "After insert -5 and 100 in l1 : ");
+
+    assert(search_data(l1, 100));
+    assert(SUCCESS == remove_data(l1, 100));
+    assert(!search_data(l1, 100));
+    assert(LIST_DATA_NOT_FOUND == remove_data(l1, 100));
+    assert(SUCCESS == remove_data(l1, -5));
+    show(l1, "After remove -5 and 100 from l1 : ");
+
+    assert(SUCCESS == destroy_list(&l1));
+    assert(l1 == NULL);
+
+
+    //----------------------------- several threads ----------------------------
+    // Every thread inserts all values, the odd values are removed once, by one of the threads
+    l1 = create_list();
+    pthread_barrier_init(&barrier, NULL, NR_THREADS);
+    for (int i = 0; i < NR_THREADS; ++i)
+    {
+        args[i].p_list = l1;
+        args[i].id = i;
+        args[i].p_barrier = &barrier;
+        assert(0 == pthread_create(&threads[i], NULL, worker, &args[i]));
+    }
+    for (int i = 0; i < NR_THREADS; ++i)
+        assert(0 == pthread_join(threads[i], NULL));
+    pthread_barrier_destroy(&barrier);
+
+    printf("length of list l1 after %d threads = %d\n", NR_THREADS, size(l1));
+    assert(NR_VALUES / 2 == size(l1));
+    for (int i = 0; i < NR_VALUES; ++i)
+        assert(search_data(l1, i) == (i % 2 == 0));
+    assert(SUCCESS == get_start(l1, &data));
+    assert(0 == data);
+
+    assert(SUCCESS == destroy_list(&l1));
+    assert(l1 == NULL);
+
+
+
+    //----------------------------- queue q1 operations ------------------------
+    // Create an empty queue q1
+    q1 = create_queue();
+    assert(q1 != NULL);
+    assert(is_queue_empty(q1));
+    assert(LIST_EMPTY == try_dequeue(q1, &data));
+
+    // Values are dequeued in the order they were enqueued
+    for (int i = 0; i < 10; ++i)
+        assert(SUCCESS == enqueue(q1, i * 10));
+    assert(!is_queue_empty(q1));
+    for (int i = 0; i < 10; ++i)
+    {
+        assert(SUCCESS == try_dequeue(q1, &data));
+        assert(i * 10 == data);
+    }
+    assert(LIST_EMPTY == try_dequeue(q1, &data));
+
+    // Half of the threads produce, the other half consume
+    for (int i = 0; i < NR_THREADS; ++i)
+        assert(0 == pthread_create(&threads[i], NULL, (i % 2 == 0) ? producer : consumer, q1));
+    for (int i = 0; i < NR_THREADS; ++i)
+    {
+        assert(0 == pthread_join(threads[i], &p_sum));
+        if (i % 2 == 1)
+            sum = sum + (long) p_sum;
+    }
+    printf("sum of the values dequeued by %d consumers = %ld\n", NR_THREADS / 2, sum);
+    assert((long) (NR_THREADS / 2) * NR_VALUES * (NR_VALUES - 1) / 2 == sum);
+    assert(is_queue_empty(q1));
+
+    assert(SUCCESS == destroy_queue(&q1));
+    assert(q1 == NULL);
+
+    // No thread is inside an operation anymore, every retired node can be freed
+    epoch_drain();
+
+    // End of the program
+    puts("PROGRAM END");
+    return (0);
+}
@@ -11,10 +11,26 @@
  * removing elements, searching for elements, adding two list, concating one list to another,
  * revering the list, sorting the list, and more.
  * 
- * The implementation uses a dummy node approach for better management of the list
- * and employs helper routines for common operations such as inserting, deleting, and
- * searching for nodes. Additionally, the file implements the merge sort algorithm
- * for sorting the list efficiently.
+ * The implementation uses a list header which owns a dummy node for better management
+ * of the list and also tracks the last node and the number of elements, so that
+ * appending, reading the last element and querying the size take constant time.
+ * It employs helper routines for common operations such as inserting, deleting, and
+ * searching for nodes. Nodes are taken from a slab based pool (pool.c) instead
+ * of being allocated one by one, and a list releases all its nodes in a single
+ * call when it is destroyed. An optional hash index (index.c), kept in sync by
+ * the insert and delete helpers, makes keyed operations constant time (see index.h
+ * for removing one of several occurrences). In the
+ * sorted mode, express lanes (skip.c) are kept over the node chain so that the
+ * list can be searched and updated in O(log n) expected time. Additionally, the file implements a natural merge sort
+ * which sorts the list by relinking its nodes, without any allocation. Ascending and
+ * strictly descending runs are detected in one pass, the descending ones are reversed
+ * and the runs are merged with balanced lengths as in TimSort, so an already sorted
+ * list is sorted in O(n). parallel_sort()
+ * cuts the list into segments which are sorted by the threads of the worker pool
+ * (workers.c) and merged pairwise in rounds, in list order and keeping equal elements
+ * in order, so the result is identical to sort(). Every merge is split by rank into
+ * parts merged by separate threads, so the last rounds run in parallel as well. show() writes the list through the buffered dumper of text.c.
+ * Built with LIST_STATS defined, the operations update the counters of stats.c.
  * 
  * This file serves as the backend implementation for the linked list data structure
  * and is intended to be used in conjunction with the corresponding header file (list.h).
@@ -22,66 +38,122 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
 #include "list.h"
+#include "pool.h"
+#include "text.h"
+#include "stats.h"
+#include "index.h"
+#include "skip.h"
+#include "workers.h"
 
-// Function to create a new list with a dummy node
+// Function to create a new list with a dummy node and a private node pool
 list_t* create_list(void)
 {
-    return get_new_node(0); // Initialize with dummy node
+    list_t* p_list = NULL;
+
+    p_list = create_list_with_pool(create_pool());
+    p_list->owns_pool = 1;
+
+    return (p_list);
+}
+
+// Function to create a new list with a dummy node, nodes are taken from p_pool
+list_t* create_list_with_pool(struct pool* p_pool)
+{
+    list_t* p_list = NULL;
+
+    p_list = (list_t*) xcalloc(1, sizeof(list_t));
+    p_list->head.data = 0;            // Initialize the dummy node
+    p_list->head.next = NULL;
+    p_list->p_tail = &p_list->head;
+    p_list->nr_elements = 0;
+    p_list->p_pool = p_pool;
+    p_list->owns_pool = 0;
+    p_list->p_index = NULL;
+    p_list->p_skip = NULL;
+
+    return (p_list);
 }
 
 // Insert a new node with data at the beginning of the list
 status_t insert_start(list_t* p_list, data_t new_data)
 {
-    generic_insert(p_list, get_new_node(new_data), p_list->next);
+    STATS_BEGIN(STATS_INSERT_START);
+    if (p_list->p_skip != NULL)
+    {
+        if (keeps_order(p_list, &p_list->head, new_data))
+            return (insert_sorted(p_list, new_data));
+        disable_sorted_mode(p_list);
+    }
+    generic_insert(p_list, &p_list->head, get_new_node(p_list, new_data), p_list->head.next);
     return (SUCCESS);
 }
 
 // Insert a new node with data at the end of the list
 status_t insert_end(list_t* p_list, data_t new_data)
 {
-    generic_insert(get_end_node(p_list), get_new_node(new_data), NULL);
+    STATS_BEGIN(STATS_INSERT_END);
+    if (p_list->p_skip != NULL)
+    {
+        if (keeps_order(p_list, p_list->p_tail, new_data))
+            return (insert_sorted(p_list, new_data));
+        disable_sorted_mode(p_list);
+    }
+    generic_insert(p_list, p_list->p_tail, get_new_node(p_list, new_data), NULL);
     return (SUCCESS);
 }
 
 // Insert a new node with new_data after the first occurrence of e_data in the list
 status_t insert_after(list_t* p_list, data_t e_data, data_t new_data)
 {
+    STATS_BEGIN(STATS_INSERT_AFTER);
     node_t* e_node = NULL;
     e_node = search_node(p_list, e_data);
     if (e_node == NULL)
         return (LIST_DATA_NOT_FOUND);
-    generic_insert(e_node, get_new_node(new_data), e_node->next);
+    if (p_list->p_skip != NULL)
+    {
+        if (keeps_order(p_list, e_node, new_data))
+            return (insert_sorted(p_list, new_data));
+        disable_sorted_mode(p_list);
+    }
+    generic_insert(p_list, e_node, get_new_node(p_list, new_data), e_node->next);
     return (SUCCESS);
 }
 
 // Insert a new node with new_data before the first occurrence of e_data in the list
 status_t insert_before(list_t* p_list, data_t e_data, data_t new_data)
 {
-    node_t* p_run = NULL;
-    for (p_run = p_list; p_run->next != NULL; p_run = p_run->next)
+    STATS_BEGIN(STATS_INSERT_BEFORE);
+    node_t* p_prev = NULL;
+    p_prev = search_prev_node(p_list, e_data);
+    if (p_prev == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    if (p_list->p_skip != NULL)
     {
-        if (p_run->next->data == e_data)
-            break;
+        if (keeps_order(p_list, p_prev, new_data))
+            return (insert_sorted(p_list, new_data));
+        disable_sorted_mode(p_list);
     }
-    if (p_run->next == NULL)
-        return (LIST_DATA_NOT_FOUND);
-    generic_insert(p_run, get_new_node(new_data), p_run->next);
+    generic_insert(p_list, p_prev, get_new_node(p_list, new_data), p_prev->next);
     return (SUCCESS);
 }
 
 // Get the data from the first node in the list
 status_t get_start(list_t* p_list, data_t* p_start_data)
 {
+    STATS_BEGIN(STATS_GET_START);
     if (is_list_empty(p_list))
         return (LIST_EMPTY);
-    *p_start_data = p_list->next->data;
+    *p_start_data = p_list->head.next->data;
     return (SUCCESS);
 }
 
 // Get the data from the last node in the list
 status_t get_end(list_t* p_list, data_t* p_end_data)
 {
+    STATS_BEGIN(STATS_GET_END);
     node_t* p_end_node = NULL;
     if (is_list_empty(p_list))
         return (LIST_EMPTY);
@@ -93,66 +165,321 @@ status_t get_end(list_t* p_list, data_t* p_end_data)
 // Remove and return the data from the first node in the list
 status_t pop_start(list_t* p_list, data_t* p_start_data)
 {
+    STATS_BEGIN(STATS_POP_START);
+    cursor_t cursor;
     if (is_list_empty(p_list))
         return (LIST_EMPTY);
-    *p_start_data = p_list->next->data;
-    generic_delete(p_list, p_list->next);
+    cursor_init(&cursor, p_list);
+    cursor_get(&cursor, p_start_data);
+    cursor_erase(&cursor);
     return (SUCCESS);
 }
 
-// Remove and return the data from the last node in the list
+// Remove and return the data from the last node in the list, the cursor finds its predecessor on the way
 status_t pop_end(list_t* p_list, data_t* p_end_data)
 {
-    node_t* p_end_node = NULL;
+    STATS_BEGIN(STATS_POP_END);
+    cursor_t cursor;
     if (is_list_empty(p_list))
         return (LIST_EMPTY);
-    p_end_node = get_end_node(p_list);
-    *p_end_data = p_end_node->data;
-    generic_delete(p_list, p_end_node);
+    cursor_init(&cursor, p_list);
+    while (cursor.p_current != p_list->p_tail)
+        cursor_next(&cursor);
+    cursor_get(&cursor, p_end_data);
+    cursor_erase(&cursor);
     return (SUCCESS);
 }
 
 // Remove the first node in the list
 status_t remove_start(list_t* p_list)
 {
-    if (is_list_empty(p_list))
-        return (LIST_EMPTY);
-    generic_delete(p_list, p_list->next);
-    return (SUCCESS);
+    STATS_BEGIN(STATS_REMOVE_START);
+    data_t data = 0;
+    return (pop_start(p_list, &data));
 }
 
 // Remove the last node in the list
 status_t remove_end(list_t* p_list)
 {
-    node_t* p_end_node = NULL;
-    if (is_list_empty(p_list))
-        return (LIST_EMPTY);
-    p_end_node = get_end_node(p_list);
-    generic_delete(p_list, p_end_node);
-    return (SUCCESS);
+    STATS_BEGIN(STATS_REMOVE_END);
+    data_t data = 0;
+    return (pop_end(p_list, &data));
 }
 
 // Remove the first occurrence of a node with data equal to r_data from the list
 status_t remove_data(list_t* p_list, data_t r_data)
 {
-    node_t* p_remove_node = NULL;
+    STATS_BEGIN(STATS_REMOVE_DATA);
+    cursor_t cursor;
     if (is_list_empty(p_list))
         return (LIST_EMPTY);
-    p_remove_node = search_node(p_list, r_data);
-    if (p_remove_node == NULL)
+    cursor_init(&cursor, p_list);
+    if (cursor_find(&cursor, r_data) != SUCCESS)
         return (LIST_DATA_NOT_FOUND);
-    generic_delete(p_list, p_remove_node);
+    cursor_erase(&cursor);
     return (SUCCESS);
 }
 
+// Remove every element for which predicate returns non zero in a single pass, the nodes go back to the pool at once
+len_t remove_if(list_t* p_list, predicate_t predicate, void* p_ctx)
+{
+    node_t* p_prev = NULL;
+    node_t* p_node = NULL;
+    node_t* p_first_removed = NULL;
+    node_t* p_last_removed = NULL;
+    len_t nr_removed = 0;
+
+    p_prev = &p_list->head;
+    while (p_prev->next != NULL)
+    {
+        p_node = p_prev->next;
+        if (!predicate(p_node->data, p_ctx))
+        {
+            p_prev = p_node;
+            continue;
+        }
+
+        // p_prev stays, its next is now the node after p_node
+        unlink_next_node(p_list, p_prev);
+        if (p_first_removed == NULL)
+            p_first_removed = p_node;
+        else
+            p_last_removed->next = p_node;
+        p_last_removed = p_node;
+        nr_removed = nr_removed + 1;
+    }
+
+    if (nr_removed > 0)
+    {
+        pool_free_chain(p_list->p_pool, p_first_removed, p_last_removed);
+        STATS_NODE_FREES(nr_removed);
+    }
+    return (nr_removed);
+}
+
+// Remove every occurrence of the nr_keys keys in a single pass, the keys are looked up in a hash set
+len_t remove_all_in(list_t* p_list, const data_t* p_keys, int nr_keys)
+{
+    index_t* p_key_set = NULL;
+    index_entry_t* p_entry = NULL;
+    len_t nr_removed = 0;
+
+    if (nr_keys <= 0 || is_list_empty(p_list))
+        return (0);
+
+    p_key_set = create_index(nr_keys);
+    for (int i = 0; i < nr_keys; ++i)
+    {
+        p_entry = index_insert(p_key_set, p_keys[i]);
+        p_entry->count = p_entry->count + 1;        // A zero count marks a free slot
+    }
+    nr_removed = remove_if(p_list, key_in_index, p_key_set);
+    destroy_index(&p_key_set);
+
+    return (nr_removed);
+}
+
 // Search for a node containing data equal to f_data in the list
 int search_data(list_t* p_list, data_t f_data)
 {
+    STATS_BEGIN(STATS_SEARCH_DATA);
     node_t* p_search_node = NULL;
     p_search_node = search_node(p_list, f_data);
     return (p_search_node != NULL);
 }
 
+// Build a hash index over the list, it is kept in sync by every later operation
+status_t enable_index(list_t* p_list)
+{
+    node_t* p_run = NULL;
+    index_entry_t* p_entry = NULL;
+
+    if (p_list->p_index == NULL)
+        p_list->p_index = create_index(size(p_list));
+    else
+        index_clear(p_list->p_index);
+    order_relabel(p_list);
+
+    for (p_run = &p_list->head; p_run->next != NULL; p_run = p_run->next)
+    {
+        p_entry = index_insert(p_list->p_index, p_run->next->data);
+        if (p_entry->count == 0)
+            p_entry->p_prev = p_run;
+        p_entry->count = p_entry->count + 1;
+    }
+    return (SUCCESS);
+}
+
+// Drop the hash index of the list, keyed operations scan the list again
+void disable_index(list_t* p_list)
+{
+    if (p_list->p_index != NULL)
+        destroy_index(&p_list->p_index);
+}
+
+// Sort the list and keep express lanes over it, searches then take O(log n) expected time
+status_t enable_sorted_mode(list_t* p_list)
+{
+    skip_tower_t* p_update[SKIP_MAX_LEVEL];
+    node_t* p_run = NULL;
+    len_t nr_levels = 0;
+
+    if (p_list->p_skip != NULL)
+        return (SUCCESS);
+
+    sort(p_list);
+    p_list->p_skip = create_skip(&p_list->head);
+    for (len_t level = 0; level < SKIP_MAX_LEVEL; ++level)
+        p_update[level] = p_list->p_skip->p_head;
+
+    // Nodes are visited in order, so every tower is linked after the last one of its lanes
+    for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+    {
+        nr_levels = skip_random_level(p_list->p_skip);
+        skip_link(p_list->p_skip, p_run, nr_levels, p_update);
+        for (len_t level = 0; level < nr_levels; ++level)
+            p_update[level] = p_update[level]->next[level];
+    }
+    return (SUCCESS);
+}
+
+// Drop the express lanes, the list is no longer kept sorted
+void disable_sorted_mode(list_t* p_list)
+{
+    if (p_list->p_skip != NULL)
+        destroy_skip(&p_list->p_skip);
+}
+
+// Insert new_data after the elements lower than or equal to it, the list must be sorted
+status_t insert_sorted(list_t* p_list, data_t new_data)
+{
+    STATS_BEGIN(STATS_INSERT_SORTED);
+    skip_tower_t* p_update[SKIP_MAX_LEVEL];
+    node_t* p_prev = NULL;
+    node_t* p_new_node = NULL;
+
+    p_prev = search_sorted_prev(p_list, new_data, 1, p_update);
+    p_new_node = get_new_node(p_list, new_data);
+    generic_insert(p_list, p_prev, p_new_node, p_prev->next);
+    if (p_list->p_skip != NULL)
+        skip_link(p_list->p_skip, p_new_node, skip_random_level(p_list->p_skip), p_update);
+    return (SUCCESS);
+}
+
+// Count the elements within [low, high], the express lanes find low in a sorted list
+len_t count_range(list_t* p_list, data_t low, data_t high)
+{
+    node_t* p_run = NULL;
+    len_t count = 0;
+
+    if (p_list->p_skip == NULL)
+    {
+        for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+            if (p_run->data >= low && p_run->data <= high)
+                count = count + 1;
+        return (count);
+    }
+
+    if (low > high)
+        return (0);
+    p_run = search_sorted_prev(p_list, low, 0, NULL)->next;
+    for (; p_run != NULL && p_run->data <= high; p_run = p_run->next)
+        count = count + 1;
+    return (count);
+}
+
+// Return new list of the elements within [low, high], in the order of the list
+list_t* get_range(list_t* p_list, data_t low, data_t high)
+{
+    list_t* p_new_list = NULL;
+    node_t* p_run = NULL;
+
+    p_new_list = create_list();
+    if (p_list->p_skip == NULL)
+    {
+        for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+            if (p_run->data >= low && p_run->data <= high)
+                insert_end(p_new_list, p_run->data);
+        return (p_new_list);
+    }
+
+    if (low > high)
+        return (p_new_list);
+    p_run = search_sorted_prev(p_list, low, 0, NULL)->next;
+    for (; p_run != NULL && p_run->data <= high; p_run = p_run->next)
+        insert_end(p_new_list, p_run->data);
+    return (p_new_list);
+}
+
+// Place the cursor on the first node of the list, past the end if the list is empty
+void cursor_init(cursor_t* p_cursor, list_t* p_list)
+{
+    p_cursor->p_list = p_list;
+    p_cursor->p_prev = &p_list->head;
+    p_cursor->p_current = p_list->head.next;
+}
+
+// Move the cursor to the first node holding f_data, from the hash index or the express lanes when there are some
+status_t cursor_find(cursor_t* p_cursor, data_t f_data)
+{
+    node_t* p_prev = NULL;
+    p_prev = search_prev_node(p_cursor->p_list, f_data);
+    if (p_prev == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    p_cursor->p_prev = p_prev;
+    p_cursor->p_current = p_prev->next;
+    return (SUCCESS);
+}
+
+// Move the cursor to the next node, LIST_DATA_NOT_FOUND if it is already past the end
+status_t cursor_next(cursor_t* p_cursor)
+{
+    if (p_cursor->p_current == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    STATS_WALK(STATS_WALK_CURSOR);
+    p_cursor->p_prev = p_cursor->p_current;
+    p_cursor->p_current = p_cursor->p_current->next;
+    return (SUCCESS);
+}
+
+// Get the data of the current node, LIST_DATA_NOT_FOUND if the cursor is past the end
+status_t cursor_get(cursor_t* p_cursor, data_t* p_data)
+{
+    if (p_cursor->p_current == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    *p_data = p_cursor->p_current->data;
+    return (SUCCESS);
+}
+
+// Insert a new node with new_data after the current node, the cursor stays on the current node
+status_t cursor_insert_after(cursor_t* p_cursor, data_t new_data)
+{
+    list_t* p_list = p_cursor->p_list;
+    node_t* p_current = p_cursor->p_current;
+
+    if (p_current == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    if (p_list->p_skip != NULL)
+    {
+        // The new node lands after the current one, among the elements equal to it
+        if (keeps_order(p_list, p_current, new_data))
+            return (insert_sorted(p_list, new_data));
+        disable_sorted_mode(p_list);
+    }
+    generic_insert(p_list, p_current, get_new_node(p_list, new_data), p_current->next);
+    return (SUCCESS);
+}
+
+// Remove the current node, the cursor moves to the node which followed it
+status_t cursor_erase(cursor_t* p_cursor)
+{
+    if (p_cursor->p_current == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    delete_next_node(p_cursor->p_list, p_cursor->p_prev);
+    p_cursor->p_current = p_cursor->p_prev->next;
+    return (SUCCESS);
+}
+
 // Add given two list in new list and retuen new list
 list_t* add_lists(list_t* p_list_1, list_t* p_list_2)
 {
@@ -161,10 +488,10 @@ list_t* add_lists(list_t* p_list_1, list_t* p_list_2)
 
     p_new_list = create_list();
     
-    for(p_run = p_list_1->next; p_run != NULL; p_run = p_run->next)
+    for(p_run = p_list_1->head.next; p_run != NULL; p_run = p_run->next)
         insert_end(p_new_list, p_run->data);
 
-    for(p_run = p_list_2->next; p_run != NULL; p_run = p_run->next)
+    for(p_run = p_list_2->head.next; p_run != NULL; p_run = p_run->next)
         insert_end(p_new_list, p_run->data);
     
     return (p_new_list);
@@ -175,13 +502,51 @@ list_t* add_lists(list_t* p_list_1, list_t* p_list_2)
 void concat_lists(list_t* p_list_1, list_t* p_list_2)
 {
     node_t* p_run = NULL;
+    node_t* p_old_tail = NULL;
+
+    if(is_list_empty(p_list_2))
+        return;
 
-    p_run = p_list_1;
-    while( p_run->next != NULL)
-        p_run = p_run->next;
+    disable_sorted_mode(p_list_1);
+    if(p_list_2->p_skip != NULL)
+    {
+        // The emptied list stays sorted, its lanes are started again
+        destroy_skip(&p_list_2->p_skip);
+        p_list_2->p_skip = create_skip(&p_list_2->head);
+    }
 
-    p_run->next = p_list_2->next;
-    p_list_2->next = NULL;
+    if(p_list_1->p_pool != p_list_2->p_pool)
+    {
+        if(!p_list_2->owns_pool)
+        {
+            // Nodes of a shared pool can not change owner, copy them instead
+            for(p_run = p_list_2->head.next; p_run != NULL; p_run = p_run->next)
+                insert_end(p_list_1, p_run->data);
+            pool_free_chain(p_list_2->p_pool, p_list_2->head.next, p_list_2->p_tail);
+            STATS_NODE_FREES(size(p_list_2));
+            p_list_2->head.next = NULL;
+            p_list_2->p_tail = &p_list_2->head;
+            p_list_2->nr_elements = 0;
+            if(p_list_2->p_index != NULL)
+                index_clear(p_list_2->p_index);
+            return;
+        }
+        pool_merge(p_list_1->p_pool, p_list_2->p_pool);
+    }
+
+    p_old_tail = p_list_1->p_tail;
+    p_list_1->p_tail->next = p_list_2->head.next;
+    p_list_1->p_tail = p_list_2->p_tail;
+    p_list_1->nr_elements = p_list_1->nr_elements + p_list_2->nr_elements;
+
+    p_list_2->head.next = NULL;
+    p_list_2->p_tail = &p_list_2->head;
+    p_list_2->nr_elements = 0;
+
+    if(p_list_1->p_index != NULL)
+        index_append_chain(p_list_1, p_old_tail);
+    if(p_list_2->p_index != NULL)
+        index_clear(p_list_2->p_index);
 }
 
 // Return new list by merging two list
@@ -195,33 +560,104 @@ list_t* get_merged_list(list_t* p_list_1, list_t* p_list_2)
     return (p_list);
 }
 
-// Return Reversed List(Reversed by value)
-list_t* get_reversed_list(list_t* p_list)
+// Merge k sorted lists into a new list by relinking their nodes, the given lists are left empty
+list_t* merge_k_sorted(list_t** pp_lists, int k)
 {
-    list_t* p_new_list = NULL;
-    node_t* p_run1 = NULL;
-    node_t* p_run2 = NULL;
-    data_t temp = 0;
-    len_t length = 0;
+    list_t* p_merged = NULL;
+    struct heap_entry* p_heap = NULL;
+    node_t* p_node = NULL;
+    int nr_entries = 0;
 
-    p_new_list = create_list();
-    length = size(p_list);
+    p_merged = create_list();
+    if (k <= 0)
+        return (p_merged);
 
-    if(is_list_empty(p_list))
-        return p_new_list;
-    
-    p_run1 = p_list;
-    for(len_t i = 0; i < length/2; ++i)
+    p_heap = (struct heap_entry*) xcalloc(k, sizeof(struct heap_entry));
+    for (int i = 0; i < k; ++i)
     {
-        p_run1 = p_run1->next;
-        p_run2 = p_list;
-        for(len_t j = length - i; j > 0; --j)
-            p_run2 = p_run2->next;
-        
-        temp = p_run1->data;
-        p_run1->data = p_run2->data;
-        p_run2->data = temp;
+        p_merged->nr_elements = p_merged->nr_elements + size(pp_lists[i]);
+        p_node = take_chain(p_merged, pp_lists[i]);
+        if (p_node == NULL)
+            continue;
+        p_heap[nr_entries].p_node = p_node;
+        p_heap[nr_entries].source = i;
+        nr_entries = nr_entries + 1;
+    }
+    for (int i = nr_entries / 2 - 1; i >= 0; --i)
+        heap_sift_down(p_heap, nr_entries, i);
+
+    // The smallest head is appended, the next node of its list takes its place in the heap
+    while (nr_entries > 0)
+    {
+        p_node = p_heap[0].p_node;
+        p_merged->p_tail->next = p_node;
+        p_merged->p_tail = p_node;
+        if (p_node->next != NULL)
+            p_heap[0].p_node = p_node->next;
+        else
+        {
+            nr_entries = nr_entries - 1;
+            p_heap[0] = p_heap[nr_entries];
+        }
+        heap_sift_down(p_heap, nr_entries, 0);
+    }
+    p_merged->p_tail->next = NULL;
+
+    free(p_heap);
+    return (p_merged);
+}
+
+// Pass the elements of k sorted lists to callback in merged order, the lists are not changed
+len_t merge_k_sorted_stream(list_t** pp_lists, int k, merge_callback_t callback, void* p_ctx)
+{
+    struct heap_entry* p_heap = NULL;
+    node_t* p_node = NULL;
+    int nr_entries = 0;
+    len_t nr_merged = 0;
+
+    if (k <= 0)
+        return (0);
+
+    p_heap = (struct heap_entry*) xcalloc(k, sizeof(struct heap_entry));
+    for (int i = 0; i < k; ++i)
+    {
+        if (is_list_empty(pp_lists[i]))
+            continue;
+        p_heap[nr_entries].p_node = pp_lists[i]->head.next;
+        p_heap[nr_entries].source = i;
+        nr_entries = nr_entries + 1;
     }
+    for (int i = nr_entries / 2 - 1; i >= 0; --i)
+        heap_sift_down(p_heap, nr_entries, i);
+
+    while (nr_entries > 0)
+    {
+        p_node = p_heap[0].p_node;
+        callback(p_node->data, p_ctx);
+        nr_merged = nr_merged + 1;
+        if (p_node->next != NULL)
+            p_heap[0].p_node = p_node->next;
+        else
+        {
+            nr_entries = nr_entries - 1;
+            p_heap[0] = p_heap[nr_entries];
+        }
+        heap_sift_down(p_heap, nr_entries, 0);
+    }
+
+    free(p_heap);
+    return (nr_merged);
+}
+
+// Return Reversed List(Reversed by value), p_list is left unchanged
+list_t* get_reversed_list(list_t* p_list)
+{
+    list_t* p_new_list = NULL;
+    node_t* p_run = NULL;
+
+    p_new_list = create_list();
+    for(p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+        insert_start(p_new_list, p_run->data);
 
     return (p_new_list);
 }
@@ -231,129 +667,520 @@ void reverse_list(list_t* p_list)
 {
     node_t* p_run = NULL;
     node_t* p_run_next = NULL;
-    node_t* p_last_node = NULL;
-    len_t length = 0;
+    node_t* p_prev = NULL;
 
-    length = size(p_list);
-    if(length <= 1)
+    if(size(p_list) <= 1)
         return;
 
-    p_last_node = get_end_node(p_list);
-    p_run = p_list; 
+    disable_sorted_mode(p_list);
+    p_run = p_list->head.next;
+    p_list->p_tail = p_run;      // First node becomes the last one
 
-    while(p_run->next != p_last_node)
+    while(p_run != NULL)
     {
         p_run_next = p_run->next;
-        p_run->next = p_run_next->next;
-        p_run_next->next = NULL;
-        generic_insert(p_last_node, p_run_next, p_last_node->next);
-    }    
+        p_run->next = p_prev;
+        p_prev = p_run;
+        p_run = p_run_next;
+    }
+    p_list->head.next = p_prev;
+
+    if(p_list->p_index != NULL)
+        enable_index(p_list);       // Every predecessor changed
 }                     
 
 // Sort the list using merge sort algorithm
 void sort(list_t* p_list)
 {
+    if(p_list->p_skip != NULL)
+        return;                     // A list in the sorted mode is already sorted
     merge_sort(p_list);
+    if(p_list->p_index != NULL)
+        enable_index(p_list);       // Every predecessor changed
+}
+
+// Define a sorted run of parallel_sort(), every PARALLEL_SORT_MARK_STRIDE-th node is marked for the search by rank
+struct sort_segment {
+    node_t* p_first;                     // First node of the run
+    node_t* p_last;                      // Last node of the run, its next is NULL
+    len_t length;                        // Number of nodes of the run
+    node_t** p_marks;                    // p_marks[i] is the node at position i * PARALLEL_SORT_MARK_STRIDE, NULL when not needed
+};
+
+// Define the state shared by the tasks of parallel_sort()
+struct parallel_sort {
+    struct sort_segment* p_runs;         // Runs merged by the current round
+    struct sort_segment* p_merged;       // Runs produced by the current round
+    int nr_parts;                        // Number of parts of every merge of the current round
+    int nr_cut;                          // Number of segments cut off the list so far
+    pthread_mutex_t lock;                // Guards nr_cut
+    pthread_cond_t cut;                  // Signalled when a segment is cut off the list
+};
+
+// Define a task of parallel_sort(), it sorts a segment or merges a part of two runs
+struct sort_task {
+    struct parallel_sort* p_sort;        // State shared by the tasks
+    int id;                              // Segment sorted, or merge * nr_parts + part for a merge round
+    len_t rank1;                         // Number of nodes of the first run merged before the part
+    node_t* p_start1;                    // First node of the first run merged into the part
+    node_t* p_start2;                    // First node of the second run merged into the part
+    node_t* p_first;                     // First node of the merged part, NULL when the part is empty
+    node_t* p_last;                      // Last node of the merged part
+};
+
+// Sort the list on nr_threads threads of the worker pool, the sorted segments are merged in rounds and every merge is split by rank
+void parallel_sort(list_t* p_list, int nr_threads)
+{
+    struct parallel_sort state;
+    struct sort_task* p_tasks = NULL;
+    node_t* p_rest = NULL;
+    len_t length = 0;
+
+    if(p_list->p_skip != NULL)
+        return;                     // A list in the sorted mode is already sorted
+
+    length = size(p_list);
+    if (nr_threads > length / PARALLEL_SORT_MIN_SEGMENT)
+        nr_threads = length / PARALLEL_SORT_MIN_SEGMENT;
+    if (nr_threads <= 1)
+    {
+        sort(p_list);
+        return;
+    }
+
+    // The marks are allocated here, the tasks do not allocate
+    state.p_runs = (struct sort_segment*) xcalloc(nr_threads, sizeof(struct sort_segment));
+    state.p_merged = (struct sort_segment*) xcalloc(nr_threads, sizeof(struct sort_segment));
+    p_tasks = (struct sort_task*) xcalloc(nr_threads, sizeof(struct sort_task));
+    state.nr_cut = 0;
+    pthread_mutex_init(&state.lock, NULL);
+    pthread_cond_init(&state.cut, NULL);
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        state.p_runs[i].length = length / nr_threads + (i < length % nr_threads);
+        state.p_runs[i].p_marks = (node_t**) xcalloc(state.p_runs[i].length / PARALLEL_SORT_MARK_STRIDE + 1, sizeof(node_t*));
+        p_tasks[i].p_sort = &state;
+        p_tasks[i].id = i;
+    }
+
+    // The first segments are sorted while the calling thread cuts the next ones
+    workers_start(sort_segment_task, p_tasks, sizeof(struct sort_task), nr_threads);
+    p_rest = p_list->head.next;
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        state.p_runs[i].p_first = p_rest;
+        p_rest = split_run(p_rest, state.p_runs[i].length);
+        pthread_mutex_lock(&state.lock);
+        state.nr_cut = i + 1;
+        pthread_cond_broadcast(&state.cut);
+        pthread_mutex_unlock(&state.lock);
+    }
+    workers_finish();
+
+    for (int nr_runs = nr_threads; nr_runs > 1; nr_runs = (nr_runs + 1) / 2)
+        merge_round(&state, p_tasks, nr_runs, nr_threads);
+
+    p_list->head.next = state.p_runs[0].p_first;
+    p_list->p_tail = state.p_runs[0].p_last;
+    pthread_cond_destroy(&state.cut);
+    pthread_mutex_destroy(&state.lock);
+    free(p_tasks);
+    free(state.p_merged);
+    free(state.p_runs);
+
+    if(p_list->p_index != NULL)
+        enable_index(p_list);       // Every predecessor changed
+}
+
+// LSD radix sort, the nodes are distributed byte by byte into bucket chains, nothing is allocated
+void radix_sort(list_t* p_list)
+{
+    if(p_list->p_skip != NULL)
+        return;                     // A list in the sorted mode is already sorted
+    if (size(p_list) <= 1)
+        return;
+
+    for (int shift = 0; shift < (int) (8 * sizeof(data_t)); shift = shift + RADIX_BITS)
+        p_list->p_tail = radix_pass(&p_list->head, shift);
+
+    if(p_list->p_index != NULL)
+        enable_index(p_list);       // Every predecessor changed
+}
+
+// Copy the elements into one contiguous block of nodes in traversal order, so that walking the list reads memory sequentially
+void compact_list(list_t* p_list)
+{
+    pool_t* p_pool = NULL;
+    node_t* p_block = NULL;
+    node_t* p_run = NULL;
+    skip_tower_t* p_tower = NULL;
+    len_t length = 0;
+    len_t i = 0;
+
+    length = size(p_list);
+    if (length == 0)
+        return;
+
+    // A private pool is replaced, which releases the scattered slabs
+    p_pool = p_list->owns_pool ? create_pool() : p_list->p_pool;
+    p_block = pool_alloc_block(p_pool, length);
+    STATS_NODE_ALLOCS(length);
+    if (p_list->p_skip != NULL)
+        p_tower = p_list->p_skip->p_head->next[0];
+    for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+    {
+        p_block[i].data = p_run->data;
+        p_block[i].next = &p_block[i + 1];
+        // The towers are met in list order on the lowest lane, each one moves with its node
+        if (p_tower != NULL && p_tower->p_node == p_run)
+        {
+            p_tower->p_node = &p_block[i];
+            p_tower = p_tower->next[0];
+        }
+        i = i + 1;
+    }
+    p_block[length - 1].next = NULL;
+
+    if (p_list->owns_pool)
+    {
+        destroy_pool(&p_list->p_pool);
+        p_list->p_pool = p_pool;
+    }
+    else
+        pool_free_chain(p_pool, p_list->head.next, p_list->p_tail);
+    STATS_NODE_FREES(length);
+    p_list->head.next = p_block;
+    p_list->p_tail = &p_block[length - 1];
+
+    if (p_list->p_index != NULL)
+        enable_index(p_list);       // Every predecessor moved
 }
 
 // Check if the list is empty
 int is_list_empty(list_t* p_list)
 {
-    return (p_list->next == NULL);
+    return (p_list->head.next == NULL);
 }
 
 // Get the size/length of the list
 len_t size(list_t* p_list)
 {
-    node_t* p_run = NULL;
-    len_t length = 0;
-    for (p_run = p_list->next; p_run != NULL; p_run = p_run->next)
-        length = length + 1;
-    return length;
+    return (p_list->nr_elements);
 }
 
 // Display the contents of the list
 void show(list_t* p_list, const char* msg)
 {
-    node_t* p_run = NULL;
     if (msg)
         puts(msg);
-    printf("[START]->");
-    for (p_run = p_list->next; p_run != NULL; p_run = p_run->next)
-        printf("[%d]->", p_run->data);
-    puts("[END]");
+    dump_list_file(p_list, stdout, TEXT_ARROWS);
 }
 
-// Destroy the list and free memory
+// Destroy the list and give its nodes back to the pool
 status_t destroy_list(list_t** pp_list)
 {
-    node_t* p_run = NULL;
-    node_t* p_run_next = NULL;
-    for (p_run = (*pp_list)->next; p_run != NULL; p_run = p_run_next)
-    {
-        p_run_next = p_run->next;
-        free(p_run);
-    }
-    free(*pp_list);
+    list_t* p_list = NULL;
+
+    STATS_LIST_DESTROYED();
+    p_list = *pp_list;
+    STATS_NODE_FREES(size(p_list));     // Given back to a shared pool or released with a private one
+    if (p_list->p_index != NULL)
+        destroy_index(&p_list->p_index);
+    if (p_list->p_skip != NULL)
+        destroy_skip(&p_list->p_skip);
+    if (p_list->owns_pool)
+        destroy_pool(&p_list->p_pool);
+    else if (!is_list_empty(p_list))
+        pool_free_chain(p_list->p_pool, p_list->head.next, p_list->p_tail);
+    free(p_list);
     *pp_list = NULL;
+    return (SUCCESS);
 }
 
 //----------------HELPER RUTINES-----------------
 
 // Generic insert function to insert a new node between beg and end
-static void generic_insert(node_t* beg, node_t* mid, node_t* end)
+static void generic_insert(list_t* p_list, node_t* beg, node_t* mid, node_t* end)
 {
     beg->next = mid;
     mid->next = end;
+    if (end == NULL)
+        p_list->p_tail = mid;
+    p_list->nr_elements = p_list->nr_elements + 1;
+    if (p_list->p_index != NULL)
+        index_after_insert(p_list, beg, mid);
 }
 
-// Generic delete function to delete a node from the list
-static void generic_delete(list_t* p_list, node_t* p_delete_node)
+// Delete the node after p_delete_prev from the list
+static void delete_next_node(list_t* p_list, node_t* p_delete_prev)
 {
-    node_t* p_delete_prev = NULL;
-    for (p_delete_prev = p_list; p_delete_prev != NULL; p_delete_prev = p_delete_prev->next)
-        if (p_delete_prev->next == p_delete_node)
-            break;
-    if (p_delete_prev == NULL)
-        return;
-    p_delete_prev->next = p_delete_node->next;
-    free(p_delete_node);
+    pool_free(p_list->p_pool, unlink_next_node(p_list, p_delete_prev));
+    STATS_NODE_FREE();
+}
+
+// Unlink the node after p_prev from the list and return it, the caller gives it back to the pool
+static node_t* unlink_next_node(list_t* p_list, node_t* p_prev)
+{
+    node_t* p_node = NULL;
+
+    p_node = p_prev->next;
+    p_prev->next = p_node->next;
+    if (p_list->p_tail == p_node)
+        p_list->p_tail = p_prev;
+    p_list->nr_elements = p_list->nr_elements - 1;
+    if (p_list->p_index != NULL)
+        index_after_delete(p_list, p_prev, p_node);
+    if (p_list->p_skip != NULL)
+        skip_unlink(p_list->p_skip, p_node);
+    return (p_node);
+}
+
+// Check if data is one of the keys of the index, used as the predicate of remove_all_in()
+static int key_in_index(data_t data, void* p_index)
+{
+    return (index_find((index_t*) p_index, data) != NULL);
 }
 
 // Search for a node containing data equal to s_data in the list
 static node_t* search_node(list_t* p_list, data_t s_data)
 {
-    node_t* p_search_node = NULL;
-    for (p_search_node = p_list->next; p_search_node != NULL; p_search_node = p_search_node->next)
-        if (p_search_node->data == s_data)
-            break;
-    return (p_search_node);
+    node_t* p_search_prev = NULL;
+    p_search_prev = search_prev_node(p_list, s_data);
+    if (p_search_prev == NULL)
+        return (NULL);
+    return (p_search_prev->next);
+}
+
+// Search for the node before the first node containing s_data, from the hash index when there is one
+static node_t* search_prev_node(list_t* p_list, data_t s_data)
+{
+    node_t* p_search_prev = NULL;
+    index_entry_t* p_entry = NULL;
+
+    if (p_list->p_index != NULL)
+    {
+        p_entry = index_find(p_list->p_index, s_data);
+        return (p_entry != NULL ? p_entry->p_prev : NULL);
+    }
+
+    if (p_list->p_skip != NULL)
+    {
+        p_search_prev = search_sorted_prev(p_list, s_data, 0, NULL);
+        if (p_search_prev->next != NULL && p_search_prev->next->data == s_data)
+            return (p_search_prev);
+        return (NULL);
+    }
+
+    for (p_search_prev = &p_list->head; p_search_prev->next != NULL; p_search_prev = p_search_prev->next)
+    {
+        STATS_WALK(STATS_WALK_SEARCH);
+        if (p_search_prev->next->data == s_data)
+            return (p_search_prev);
+    }
+    return (NULL);
+}
+
+// Get the node after which key belongs in a sorted list: the node before the first
+// element greater than key (inclusive) or greater than or equal to key (otherwise)
+static node_t* search_sorted_prev(list_t* p_list, data_t key, int inclusive, struct skip_tower** pp_update)
+{
+    node_t* p_prev = NULL;
+
+    p_prev = &p_list->head;
+    if (p_list->p_skip != NULL)
+        p_prev = skip_search(p_list->p_skip, key, inclusive, pp_update)->p_node;
+
+    while (p_prev->next != NULL &&
+           (p_prev->next->data < key || (inclusive && p_prev->next->data == key)))
+    {
+        STATS_WALK(STATS_WALK_SEARCH);
+        p_prev = p_prev->next;
+    }
+    return (p_prev);
+}
+
+// Check if new_data can be inserted after p_prev without breaking the order of the list
+static int keeps_order(list_t* p_list, node_t* p_prev, data_t new_data)
+{
+    if (p_prev != &p_list->head && p_prev->data > new_data)
+        return (0);
+    if (p_prev->next != NULL && p_prev->next->data < new_data)
+        return (0);
+    return (1);
 }
 
 // Create a new node with data equal to new_data
-static node_t* get_new_node(data_t new_data)
+static node_t* get_new_node(list_t* p_list, data_t new_data)
 {
     node_t* p_new_node = NULL;
-    p_new_node = (node_t*) xcalloc(1, sizeof(node_t));
+    STATS_NODE_ALLOC();
+    p_new_node = pool_alloc(p_list->p_pool);
     p_new_node->data = new_data;
     p_new_node->next = NULL;
     return (p_new_node);
 }
 
-// Get the last node in the list
+// Get the last node in the list (the dummy node when the list is empty)
 static node_t* get_end_node(list_t* p_list)
 {
-    node_t* p_end_node = NULL;
-    p_end_node = p_list;
-    while (p_end_node->next != NULL)
-        p_end_node = p_end_node->next;
-    return (p_end_node);
+    return (p_list->p_tail);
+}
+
+// Keep the hash index in sync after p_new_node was linked after p_prev
+static void index_after_insert(list_t* p_list, node_t* p_prev, node_t* p_new_node)
+{
+    index_entry_t* p_entry = NULL;
+    node_t* p_next = NULL;
+
+    order_label(p_list, p_prev, p_new_node);
+
+    // The next node may have been the first occurrence of its element
+    p_next = p_new_node->next;
+    if (p_next != NULL)
+    {
+        p_entry = index_find(p_list->p_index, p_next->data);
+        if (p_entry->p_prev == p_prev)
+            p_entry->p_prev = p_new_node;
+    }
+
+    // The order labels tell which of two occurrences comes first without walking the list
+    p_entry = index_insert(p_list->p_index, p_new_node->data);
+    p_entry->count = p_entry->count + 1;
+    if (p_entry->count == 1 || p_new_node->order < p_entry->p_prev->next->order)
+        p_entry->p_prev = p_prev;
+}
+
+// Keep the hash index in sync after p_delete_node was unlinked from after p_prev
+static void index_after_delete(list_t* p_list, node_t* p_prev, node_t* p_delete_node)
+{
+    index_entry_t* p_entry = NULL;
+    node_t* p_run = NULL;
+
+    // The next node may have been the first occurrence of its element
+    if (p_prev->next != NULL)
+    {
+        p_entry = index_find(p_list->p_index, p_prev->next->data);
+        if (p_entry->p_prev == p_delete_node)
+            p_entry->p_prev = p_prev;
+    }
+
+    p_entry = index_find(p_list->p_index, p_delete_node->data);
+    p_entry->count = p_entry->count - 1;
+    if (p_entry->count == 0)
+    {
+        index_erase(p_list->p_index, p_entry);
+        return;
+    }
+    if (p_entry->p_prev != p_prev)
+        return;
+
+    // The first occurrence was deleted, the next one is found by walking up to it
+    for (p_run = p_prev; p_run->next->data != p_delete_node->data; p_run = p_run->next)
+        ;
+    p_entry->p_prev = p_run;
+}
+
+// Add the nodes after p_prev, appended at the end of the list, to the hash index
+static void index_append_chain(list_t* p_list, node_t* p_prev)
+{
+    index_entry_t* p_entry = NULL;
+    unsigned long long order = 0;
+
+    order = p_prev->order;
+    for (; p_prev->next != NULL; p_prev = p_prev->next)
+    {
+        order = order + p_list->p_index->order_step;
+        p_prev->next->order = (unsigned int) order;
+        p_entry = index_insert(p_list->p_index, p_prev->next->data);
+        if (p_entry->count == 0)
+            p_entry->p_prev = p_prev;
+        p_entry->count = p_entry->count + 1;
+    }
+
+    // The appended nodes did not fit after the last label
+    if (order >= INDEX_ORDER_SPACE)
+        order_relabel(p_list);
+}
+
+// Give p_new_node, linked after p_prev, a label between the labels of its neighbours
+static void order_label(list_t* p_list, node_t* p_prev, node_t* p_new_node)
+{
+    unsigned long long low = 0;
+    unsigned long long high = INDEX_ORDER_SPACE;
+
+    low = p_prev->order;
+    if (p_new_node->next != NULL)
+        high = p_new_node->next->order;
+    else if (low + p_list->p_index->order_step < high)
+    {
+        // Appended nodes are spaced as by the last relabelling
+        p_new_node->order = (unsigned int) (low + p_list->p_index->order_step);
+        return;
+    }
+
+    if (high - low >= 2)
+        p_new_node->order = (unsigned int) (low + (high - low) / 2);
+    else
+        order_spread(p_list, p_prev);
+}
+
+// Relabel evenly the nodes after p_prev up to the first node whose label leaves them enough room, every node if none does
+static void order_spread(list_t* p_list, node_t* p_prev)
+{
+    node_t* p_end = NULL;
+    node_t* p_run = NULL;
+    unsigned long long low = 0;
+    unsigned long long high = 0;
+    unsigned long long nr_nodes = 0;
+    unsigned long long i = 0;
+
+    // The range grows until it spans more labels than the square of its number of nodes, so a crowded spot only relabels its neighbourhood
+    low = p_prev->order;
+    p_end = p_prev->next;
+    do
+    {
+        nr_nodes = nr_nodes + 1;
+        p_end = p_end->next;
+        if (p_end == NULL)
+        {
+            order_relabel(p_list);
+            return;
+        }
+        high = p_end->order;
+    } while (high - low <= (nr_nodes + 1) * (nr_nodes + 1));
+
+    for (p_run = p_prev->next; p_run != p_end; p_run = p_run->next)
+    {
+        i = i + 1;
+        p_run->order = (unsigned int) (low + (high - low) * i / (nr_nodes + 1));
+    }
+}
+
+// Label every node again, the labels leave the upper half of the range free for appended nodes
+static void order_relabel(list_t* p_list)
+{
+    node_t* p_run = NULL;
+    unsigned long long step = 0;
+    unsigned long long order = 0;
+
+    step = (INDEX_ORDER_SPACE / 2) / ((unsigned long long) size(p_list) + 1);
+    if (step == 0)
+        step = 1;
+
+    p_list->head.order = 0;
+    for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+    {
+        order = order + step;
+        p_run->order = (unsigned int) order;
+    }
+    p_list->p_index->order_step = (unsigned int) step;
 }
 
 // Allocate memory for an array with specified number of elements and size per element
 void* xcalloc(int nr_of_element, len_t size_per_element)
 {
     void* p = NULL;
+    STATS_ALLOC((long) nr_of_element * size_per_element);
     p = calloc(nr_of_element, size_per_element);
     if (p == NULL)
     {
@@ -363,72 +1190,485 @@ void* xcalloc(int nr_of_element, len_t size_per_element)
     return p;
 }
 
-// Merge sort algorithm to sort the list
+// Natural merge sort of the whole list by relinking its nodes
 static void merge_sort(list_t* p_list)
 {
     len_t length = 0;
-    list_t* l1 = NULL;
-    list_t* l2 = NULL;
-    node_t* p_run = NULL;
 
     length = size(p_list);
-    
     if (length <= 1)
         return;
-    
-    l1 = create_list();
-    l2 = create_list();
 
-    p_run = p_list->next;
-    for (len_t i = 0; i < length / 2; ++i)
+    p_list->p_tail = sort_chain(&p_list->head);
+}
+
+// Natural merge sort of the chain after p_head, existing runs are kept and merged with balanced lengths
+static node_t* sort_chain(node_t* p_head)
+{
+    struct sort_run runs[SORT_MAX_RUNS];
+    node_t* p_rest = NULL;
+    int nr_runs = 0;
+
+    p_rest = p_head->next;
+    if (p_rest == NULL)
+        return (p_head);
+
+    while (p_rest != NULL)
     {
-        insert_end(l1, p_run->data);
-        p_run = p_run->next;
+        p_rest = find_run(p_rest, &runs[nr_runs]);
+        nr_runs = collapse_runs(runs, nr_runs + 1);
+    }
+    while (nr_runs > 1)
+    {
+        merge_runs(runs, nr_runs, nr_runs - 2);
+        nr_runs = nr_runs - 1;
     }
 
-    for (len_t i = length / 2; i < length; ++i)
+    p_head->next = runs[0].p_first;
+    return (runs[0].p_last);
+}
+
+// Cut the next run off the chain starting at p_first, a strictly descending run is reversed, a short run is extended
+static node_t* find_run(node_t* p_first, struct sort_run* p_run)
+{
+    node_t* p_rest = NULL;
+    node_t* p_next = NULL;
+
+    p_run->p_first = p_first;
+    p_run->p_last = p_first;
+    p_run->length = 1;
+    p_rest = p_first->next;
+
+    if (p_rest != NULL && p_rest->data < p_first->data)
+    {
+        // Strictly descending, so reversing it keeps equal elements in order
+        p_first->next = NULL;
+        while (p_rest != NULL && p_rest->data < p_run->p_first->data)
+        {
+            p_next = p_rest->next;
+            p_rest->next = p_run->p_first;
+            p_run->p_first = p_rest;
+            p_run->length = p_run->length + 1;
+            p_rest = p_next;
+        }
+    }
+    else
     {
-        insert_end(l2, p_run->data);
-        p_run = p_run->next;
+        while (p_rest != NULL && p_rest->data >= p_run->p_last->data)
+        {
+            p_run->p_last = p_rest;
+            p_run->length = p_run->length + 1;
+            p_rest = p_rest->next;
+        }
+        p_run->p_last->next = NULL;
     }
 
-    p_list->next = NULL;
-    merge_sort(l1);
-    merge_sort(l2);
-    merge(l1, l2, p_list);
+    while (p_rest != NULL && p_run->length < SORT_MIN_RUN)
+    {
+        p_next = p_rest->next;
+        insert_into_run(p_run, p_rest);
+        p_rest = p_next;
+    }
+    return (p_rest);
 }
 
-// Merge two sorted lists l1 and l2 into the list p_list
-static void merge(list_t* l1, list_t* l2, list_t* p_list)
+// Insert a node into a run, after the elements of the run which are not greater
+static void insert_into_run(struct sort_run* p_run, node_t* p_node)
 {
-    node_t* p_run1 = NULL;
-    node_t* p_run2 = NULL;
-    p_run1 = l1->next;
-    p_run2 = l2->next;
+    node_t* p_prev = NULL;
 
-    while (p_run1 != NULL && p_run2 != NULL)
+    if (p_node->data >= p_run->p_last->data)
+    {
+        p_node->next = NULL;
+        p_run->p_last->next = p_node;
+        p_run->p_last = p_node;
+    }
+    else if (p_node->data < p_run->p_first->data)
+    {
+        p_node->next = p_run->p_first;
+        p_run->p_first = p_node;
+    }
+    else
     {
-        if (p_run1->data < p_run2->data)
+        p_prev = p_run->p_first;
+        while (p_prev->next->data <= p_node->data)
+            p_prev = p_prev->next;
+        p_node->next = p_prev->next;
+        p_prev->next = p_node;
+    }
+    p_run->length = p_run->length + 1;
+}
+
+// Merge the newest pending runs while their lengths do not shrink fast enough, as in TimSort
+static int collapse_runs(struct sort_run* p_runs, int nr_runs)
+{
+    int i = 0;
+
+    while (nr_runs > 1)
+    {
+        i = nr_runs - 2;
+        if ((i > 0 && p_runs[i - 1].length <= p_runs[i].length + p_runs[i + 1].length) ||
+            (i > 1 && p_runs[i - 2].length <= p_runs[i - 1].length + p_runs[i].length))
         {
-            insert_end(p_list, p_run1->data);
-            p_run1 = p_run1->next;
+            if (p_runs[i - 1].length < p_runs[i + 1].length)
+                i = i - 1;
         }
+        else if (p_runs[i].length > p_runs[i + 1].length)
+            break;
+        merge_runs(p_runs, nr_runs, i);
+        nr_runs = nr_runs - 1;
+    }
+    return (nr_runs);
+}
+
+// Merge run i with run i + 1 into run i, runs already in order are only linked
+static void merge_runs(struct sort_run* p_runs, int nr_runs, int i)
+{
+    node_t head;
+
+    if (p_runs[i].p_last->data <= p_runs[i + 1].p_first->data)
+    {
+        p_runs[i].p_last->next = p_runs[i + 1].p_first;
+        p_runs[i].p_last = p_runs[i + 1].p_last;
+    }
+    else
+    {
+        head.next = NULL;
+        p_runs[i].p_last = merge(p_runs[i].p_first, p_runs[i + 1].p_first, &head);
+        p_runs[i].p_first = head.next;
+    }
+    p_runs[i].length = p_runs[i].length + p_runs[i + 1].length;
+
+    for (int j = i + 1; j < nr_runs - 1; ++j)
+        p_runs[j] = p_runs[j + 1];
+}
+
+// Detach the nodes of p_src_list as a NULL terminated chain owned by the pool of p_dest_list, return its first node
+static node_t* take_chain(list_t* p_dest_list, list_t* p_src_list)
+{
+    node_t* p_first = NULL;
+    node_t* p_last = NULL;
+    node_t* p_run = NULL;
+
+    if (is_list_empty(p_src_list))
+        return (NULL);
+
+    p_first = p_src_list->head.next;
+
+    if (p_src_list->p_pool != p_dest_list->p_pool)
+    {
+        if (p_src_list->owns_pool)
+            pool_merge(p_dest_list->p_pool, p_src_list->p_pool);
         else
         {
-            insert_end(p_list, p_run2->data);
-            p_run2 = p_run2->next;
+            // Nodes of a shared pool can not change owner, copy them instead
+            p_last = get_new_node(p_dest_list, p_first->data);
+            p_run = p_first;
+            p_first = p_last;
+            for (p_run = p_run->next; p_run != NULL; p_run = p_run->next)
+            {
+                p_last->next = get_new_node(p_dest_list, p_run->data);
+                p_last = p_last->next;
+            }
+            p_last->next = NULL;
+            pool_free_chain(p_src_list->p_pool, p_src_list->head.next, p_src_list->p_tail);
+            STATS_NODE_FREES(size(p_src_list));
         }
     }
 
-    while (p_run1 != NULL)
+    p_src_list->head.next = NULL;
+    p_src_list->p_tail = &p_src_list->head;
+    p_src_list->nr_elements = 0;
+    if (p_src_list->p_index != NULL)
+        index_clear(p_src_list->p_index);
+    if (p_src_list->p_skip != NULL)
     {
-        insert_end(p_list, p_run1->data);
-        p_run1 = p_run1->next;
+        // The emptied list stays sorted, its lanes are started again
+        destroy_skip(&p_src_list->p_skip);
+        p_src_list->p_skip = create_skip(&p_src_list->head);
     }
+    return (p_first);
+}
+
+// Order of the heap entries, by element then by position of the list
+static int heap_less(const struct heap_entry* p_entry_1, const struct heap_entry* p_entry_2)
+{
+    if (p_entry_1->p_node->data != p_entry_2->p_node->data)
+        return (p_entry_1->p_node->data < p_entry_2->p_node->data);
+    return (p_entry_1->source < p_entry_2->source);
+}
+
+// Move entry i down the heap until both its children are greater
+static void heap_sift_down(struct heap_entry* p_heap, int nr_entries, int i)
+{
+    struct heap_entry entry;
+    int child = 0;
+
+    if (nr_entries <= 1)
+        return;
+    entry = p_heap[i];
+    while ((child = 2 * i + 1) < nr_entries)
+    {
+        if (child + 1 < nr_entries && heap_less(&p_heap[child + 1], &p_heap[child]))
+            child = child + 1;
+        if (!heap_less(&p_heap[child], &entry))
+            break;
+        p_heap[i] = p_heap[child];
+        i = child;
+    }
+    p_heap[i] = entry;
+}
+
+// Distribute the chain after p_head into bucket chains by the byte at shift and link the buckets in order
+static node_t* radix_pass(node_t* p_head, int shift)
+{
+    node_t* p_first[RADIX_BUCKETS] = {NULL};
+    node_t* p_last[RADIX_BUCKETS] = {NULL};
+    node_t* p_run = NULL;
+    node_t* p_prev = NULL;
+    unsigned int bucket = 0;
 
-    while (p_run2 != NULL)
+    for (p_run = p_head->next; p_run != NULL; p_run = p_run->next)
     {
-        insert_end(p_list, p_run2->data);
-        p_run2 = p_run2->next;
+        // Flipping the sign bit orders negative values before positive ones
+        bucket = (((unsigned int) p_run->data ^ 0x80000000u) >> shift) & (RADIX_BUCKETS - 1);
+        if (p_first[bucket] == NULL)
+            p_first[bucket] = p_run;
+        else
+            p_last[bucket]->next = p_run;
+        p_last[bucket] = p_run;
+    }
+
+    p_prev = p_head;
+    for (int i = 0; i < RADIX_BUCKETS; ++i)
+    {
+        if (p_first[i] == NULL)
+            continue;
+        p_prev->next = p_first[i];
+        p_prev = p_last[i];
     }
+    p_prev->next = NULL;
+    return (p_prev);
+}
+
+// Wait until the segment is cut off the list and sort it, the merge of its sorted halves marks it on the way
+static void sort_segment_task(void* p_task)
+{
+    struct sort_task* p_this = (struct sort_task*) p_task;
+    struct parallel_sort* p_sort = p_this->p_sort;
+    struct sort_segment* p_run = &p_sort->p_runs[p_this->id];
+    node_t* p_second = NULL;
+    node_t head;
+
+    pthread_mutex_lock(&p_sort->lock);
+    while (p_sort->nr_cut <= p_this->id)
+        pthread_cond_wait(&p_sort->cut, &p_sort->lock);
+    pthread_mutex_unlock(&p_sort->lock);
+
+    p_second = split_run(p_run->p_first, p_run->length / 2);
+    head.next = p_run->p_first;
+    sort_chain(&head);
+    p_run->p_first = head.next;
+    head.next = p_second;
+    sort_chain(&head);
+    p_second = head.next;
+
+    p_run->p_last = merge_marked(&head, p_run->p_first, p_run->length / 2, p_second, p_run->length - p_run->length / 2,
+                                 p_run->p_marks, 0);
+    p_run->p_first = head.next;
+}
+
+// Merge the runs pairwise, every merge is split into parts merged by separate tasks, an odd run is carried over
+static void merge_round(struct parallel_sort* p_sort, struct sort_task* p_tasks, int nr_runs, int nr_threads)
+{
+    struct sort_segment* p_swap = NULL;
+    struct sort_segment* p_merged = NULL;
+    struct sort_task* p_part = NULL;
+    node_t* p_last = NULL;
+    int nr_merges = nr_runs / 2;
+    int nr_parts = nr_threads / nr_merges;
+
+    // The runs of the last round need no marks
+    p_sort->nr_parts = nr_parts;
+    for (int i = 0; i < nr_merges; ++i)
+    {
+        p_merged = &p_sort->p_merged[i];
+        p_merged->length = p_sort->p_runs[2 * i].length + p_sort->p_runs[2 * i + 1].length;
+        p_merged->p_marks = NULL;
+        if (nr_runs > 2)
+            p_merged->p_marks = (node_t**) xcalloc(p_merged->length / PARALLEL_SORT_MARK_STRIDE + 1, sizeof(node_t*));
+    }
+
+    // Every part is found before any node is relinked
+    workers_run(split_task, p_tasks, sizeof(struct sort_task), nr_merges * nr_parts);
+    workers_run(merge_part_task, p_tasks, sizeof(struct sort_task), nr_merges * nr_parts);
+
+    for (int i = 0; i < nr_merges; ++i)
+    {
+        p_merged = &p_sort->p_merged[i];
+        p_last = NULL;
+        for (int part = 0; part < nr_parts; ++part)
+        {
+            p_part = &p_tasks[i * nr_parts + part];
+            if (p_part->p_first == NULL)
+                continue;
+            if (p_last == NULL)
+                p_merged->p_first = p_part->p_first;
+            else
+            {
+                p_last->next = p_part->p_first;
+            }
+            p_last = p_part->p_last;
+        }
+        p_last->next = NULL;
+        p_merged->p_last = p_last;
+        free(p_sort->p_runs[2 * i].p_marks);
+        free(p_sort->p_runs[2 * i + 1].p_marks);
+    }
+    if (nr_runs % 2 == 1)
+        p_sort->p_merged[nr_merges] = p_sort->p_runs[nr_runs - 1];
+
+    p_swap = p_sort->p_runs;
+    p_sort->p_runs = p_sort->p_merged;
+    p_sort->p_merged = p_swap;
+}
+
+// Find where the part of a merge starts in both runs
+static void split_task(void* p_task)
+{
+    struct sort_task* p_this = (struct sort_task*) p_task;
+    struct parallel_sort* p_sort = p_this->p_sort;
+    struct sort_segment* p_run1 = &p_sort->p_runs[2 * (p_this->id / p_sort->nr_parts)];
+    struct sort_segment* p_run2 = p_run1 + 1;
+    len_t rank = part_rank(p_run1->length + p_run2->length, p_this->id % p_sort->nr_parts, p_sort->nr_parts);
+
+    p_this->rank1 = split_rank(p_run1, p_run2, rank);
+    p_this->p_start1 = run_node(p_run1, p_this->rank1);
+    p_this->p_start2 = run_node(p_run2, rank - p_this->rank1);
+}
+
+// Merge one part of two runs, found by split_task(), the merged nodes are marked by rank
+static void merge_part_task(void* p_task)
+{
+    struct sort_task* p_this = (struct sort_task*) p_task;
+    struct parallel_sort* p_sort = p_this->p_sort;
+    int part = p_this->id % p_sort->nr_parts;
+    struct sort_segment* p_run1 = &p_sort->p_runs[2 * (p_this->id / p_sort->nr_parts)];
+    struct sort_segment* p_merged = &p_sort->p_merged[p_this->id / p_sort->nr_parts];
+    len_t rank = part_rank(p_merged->length, part, p_sort->nr_parts);
+    len_t end = part_rank(p_merged->length, part + 1, p_sort->nr_parts);
+    len_t nr_nodes_1 = ((part + 1 < p_sort->nr_parts) ? p_this[1].rank1 : p_run1->length) - p_this->rank1;
+    node_t head;
+
+    p_this->p_last = merge_marked(&head, p_this->p_start1, nr_nodes_1, p_this->p_start2, end - rank - nr_nodes_1,
+                                  p_merged->p_marks, rank);
+    p_this->p_first = (p_this->p_last != &head) ? head.next : NULL;
+}
+
+// Link nr_nodes_1 nodes from p_node_1 and nr_nodes_2 nodes from p_node_2 after p_head in order, equal elements are
+// taken from p_node_1 first, the nodes at the marked ranks are recorded in p_marks, return the last node linked
+static node_t* merge_marked(node_t* p_head, node_t* p_node_1, len_t nr_nodes_1, node_t* p_node_2, len_t nr_nodes_2,
+                            node_t** p_marks, len_t rank)
+{
+    node_t* p_prev = p_head;
+    node_t* p_node = NULL;
+
+    for (len_t end = rank + nr_nodes_1 + nr_nodes_2; rank < end; ++rank)
+    {
+        if (nr_nodes_2 == 0 || (nr_nodes_1 > 0 && p_node_1->data <= p_node_2->data))
+        {
+            p_node = p_node_1;
+            p_node_1 = p_node_1->next;
+            nr_nodes_1 = nr_nodes_1 - 1;
+        }
+        else
+        {
+            p_node = p_node_2;
+            p_node_2 = p_node_2->next;
+            nr_nodes_2 = nr_nodes_2 - 1;
+        }
+        p_prev->next = p_node;
+        p_prev = p_node;
+        if (p_marks != NULL && rank % PARALLEL_SORT_MARK_STRIDE == 0)
+            p_marks[rank / PARALLEL_SORT_MARK_STRIDE] = p_node;
+    }
+    p_prev->next = NULL;
+    return (p_prev);
+}
+
+// Return how many nodes of p_run1 come first among the first rank nodes of the merge of both runs
+static len_t split_rank(struct sort_segment* p_run1, struct sort_segment* p_run2, len_t rank)
+{
+    len_t low = (rank > p_run2->length) ? rank - p_run2->length : 0;
+    len_t high = (rank < p_run1->length) ? rank : p_run1->length;
+    len_t mid = 0;
+
+    // Binary search into both runs, the element of p_run1 goes first when they are equal
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+        if (run_node(p_run1, mid)->data <= run_node(p_run2, rank - mid - 1)->data)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return (low);
+}
+
+// Return the node at position in a marked run, NULL past its end
+static node_t* run_node(struct sort_segment* p_run, len_t position)
+{
+    node_t* p_node = NULL;
+
+    if (position >= p_run->length)
+        return (NULL);
+    p_node = p_run->p_marks[position / PARALLEL_SORT_MARK_STRIDE];
+    for (len_t i = position % PARALLEL_SORT_MARK_STRIDE; i > 0; --i)
+        p_node = p_node->next;
+    return (p_node);
+}
+
+// Return the first rank of a part when total nodes are split into nr_parts parts
+static len_t part_rank(len_t total, int part, int nr_parts)
+{
+    return ((len_t) ((long long) total * part / nr_parts));
+}
+
+// Cut the chain starting at p_first after run_length nodes and return the remaining chain
+static node_t* split_run(node_t* p_first, len_t run_length)
+{
+    node_t* p_rest = NULL;
+
+    if (p_first == NULL)
+        return (NULL);
+    for (len_t i = 1; i < run_length && p_first->next != NULL; ++i)
+        p_first = p_first->next;
+    p_rest = p_first->next;
+    p_first->next = NULL;
+    return (p_rest);
+}
+
+// Merge the sorted chains p_run1 and p_run2 after p_prev, equal elements keep their order
+static node_t* merge(node_t* p_run1, node_t* p_run2, node_t* p_prev)
+{
+    while (p_run1 != NULL && p_run2 != NULL)
+    {
+        if (p_run1->data <= p_run2->data)
+        {
+            p_prev->next = p_run1;
+            p_prev = p_run1;
+            p_run1 = p_run1->next;
+        }
+        else
+        {
+            p_prev->next = p_run2;
+            p_prev = p_run2;
+            p_run2 = p_run2->next;
+        }
+    }
+
+    p_prev->next = (p_run1 != NULL) ? p_run1 : p_run2;
+    while (p_prev->next != NULL)
+        p_prev = p_prev->next;
+    return (p_prev);
 }
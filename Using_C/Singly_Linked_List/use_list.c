@@ -17,15 +17,58 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <limits.h>
 #include "list.h"
+#include "compressed.h"
+#include "mapped.h"
+#include "text.h"
+#include "stats.h"
+#include "pipeline.h"
+
+// Halve data, used as a map stage
+static data_t halve(data_t data, void* p_ctx)
+{
+    (void) p_ctx;
+    return (data / 2);
+}
+
+// Select the multiples of four, used as a filter stage
+static int is_multiple_of_four(data_t data, void* p_ctx)
+{
+    (void) p_ctx;
+    return (data % 4 == 0);
+}
+
+// Add data to acc, used to reduce a pipeline
+static data_t add(data_t acc, data_t data, void* p_ctx)
+{
+    (void) p_ctx;
+    return (acc + data);
+}
 
 int main(void)
 {
     list_t* l1 = NULL;
     list_t* l2 = NULL;
     list_t* l3 = NULL;
+    list_t* l4 = NULL;
+    list_t* l5 = NULL;
+    list_t* l6 = NULL;
+    list_t* l7 = NULL;
+    list_t* lists[3];
+    clist_t* c1 = NULL;
+    clist_t* c2 = NULL;
+    clist_t* c3 = NULL;
+    clist_iter_t iter;
+    mlist_t* m1 = NULL;
+    FILE* p_file = NULL;
+    cursor_t cursor;
+    data_t keys[2];
+    pipeline_t pipeline;
+    list_stats_t stats;
 
     data_t data = 0;
+    data_t expected = 0;
     len_t length = 0;
 
     // Start of the program
@@ -260,7 +303,10 @@ int main(void)
     // Add elements of l1 and l2 and store in l3
     l3 = add_lists(l1, l2);
     show(l3, "After adding l1, l2 : l3 is ");
-    
+
+    // Destroy list l3 and free memory
+    destroy_list(&l3);
+
     // Getting mearge list of l1 and l2
     l3 = get_merged_list(l1, l2);
     show(l3, "After mearing l1, l2 in l3 : ");
@@ -282,16 +328,197 @@ int main(void)
     
     // Get the reversed list l1 and store it in l3
     l3 = get_reversed_list(l1);
-    show(l1, "After reversing l1 and storing in l3 : l3 is");
+    assert(size(l3) == size(l1));
+    assert(SUCCESS == get_start(l1, &data));
+    assert(SUCCESS == get_end(l3, &keys[0]));
+    assert(data == keys[0]);
+    show(l3, "After reversing l1 and storing in l3 : l3 is");
 
     // Reverse list l1
     reverse_list(l1);
     show(l1, "After reversing l1 : ");
 
-    // Destroy the lists l1, l2, and l3 and free memory
+    // Merge the sorted lists l1, l2 and l3 in l4, their nodes are moved to l4
+    sort(l1);
+    sort(l2);
+    sort(l3);
+    length = size(l1) + size(l2) + size(l3);
+    lists[0] = l1;
+    lists[1] = l2;
+    lists[2] = l3;
+    l4 = merge_k_sorted(lists, 3);
+    assert(length == size(l4));
+    assert(is_list_empty(l1) && is_list_empty(l2) && is_list_empty(l3));
+    show(l4, "After merging the sorted lists l1, l2 and l3 in l4 : ");
+
+    // Compress the sorted list l4, its elements can still be searched
+    c1 = create_clist(l4);
+    assert(c1 != NULL);
+    assert(size(l4) == clist_size(c1));
+    assert(SUCCESS == get_end(l4, &data));
+    assert(clist_search_data(c1, data));
+    printf("compressed l4 : %d elements in %ld bytes\n", clist_size(c1), clist_memory(c1));
+    destroy_clist(&c1);
+
+    // Merge two compressed lists with negative and repeated elements, walking the merge
+    // and expanding it must give the elements of both lists, sorted
+    l5 = create_list();
+    insert_end(l5, INT_MIN);
+    insert_end(l5, -40);
+    insert_end(l5, -7);
+    insert_end(l5, -7);
+    insert_end(l5, 0);
+    insert_end(l5, 1000);
+    l6 = create_list();
+    insert_end(l6, -50);
+    insert_end(l6, -7);
+    insert_end(l6, 0);
+    insert_end(l6, 0);
+    insert_end(l6, 999);
+    insert_end(l6, INT_MAX);
+    c1 = create_clist(l5);
+    c2 = create_clist(l6);
+    assert(c1 != NULL && c2 != NULL);
+    c3 = clist_merge(c1, c2);
+    assert(clist_size(c3) == size(l5) + size(l6));
+    l7 = add_lists(l5, l6);
+    sort(l7);
+
+    clist_iter_init(&iter, c3);
+    cursor_init(&cursor, l7);
+    while (clist_iter_next(&iter, &data))
+    {
+        assert(SUCCESS == cursor_get(&cursor, &expected) && expected == data);
+        cursor_next(&cursor);
+    }
+    assert(LIST_DATA_NOT_FOUND == cursor_get(&cursor, &expected));
+
+    destroy_list(&l5);
+    l5 = clist_to_list(c3);
+    assert(size(l5) == size(l7));
+    while (SUCCESS == pop_start(l7, &data))
+        assert(SUCCESS == pop_start(l5, &expected) && expected == data);
+    assert(is_list_empty(l5));
+    destroy_clist(&c3);
+    destroy_clist(&c2);
+    destroy_clist(&c1);
+    destroy_list(&l7);
+    destroy_list(&l6);
+    destroy_list(&l5);
+
+    // Save l4 to a file and map it back, its elements are read from the file
+    assert(SUCCESS == save_list(l4, "list_demo.bin"));
+    m1 = map_list("list_demo.bin");
+    assert(m1 != NULL);
+    assert(size(l4) == mlist_size(m1));
+    assert(SUCCESS == mlist_get_end(m1, &data));
+    assert(mlist_search_data(m1, data));
+    destroy_list(&l4);
+    l4 = mlist_to_list(m1);
+    assert(size(l4) == mlist_size(m1));
+    show(l4, "After loading l4 from the mapped file : ");
+    unmap_list(&m1);
+    remove("list_demo.bin");
+
+    // Write l4 as text, one element per line, and load it back in the emptied l3
+    p_file = fopen("list_demo.txt", "w+");
+    assert(p_file != NULL);
+    assert(SUCCESS == dump_list_file(l4, p_file, TEXT_LINES));
+    rewind(p_file);
+    assert(SUCCESS == load_list_file(l3, p_file));
+    fclose(p_file);
+    remove("list_demo.txt");
+    assert(size(l3) == size(l4));
+    show(l3, "After loading l3 from the text file : ");
+
+    // A number out of the range of data_t stops the loading, the elements before it are kept
+    l5 = create_list();
+    p_file = fopen("list_demo.txt", "w+");
+    assert(p_file != NULL);
+    fputs("-2147483648 2147483647\n12345678901\n7\n", p_file);
+    rewind(p_file);
+    assert(LIST_IO_ERROR == load_list_file(l5, p_file));
+    fclose(p_file);
+    remove("list_demo.txt");
+    assert(size(l5) == 2);
+    assert(SUCCESS == get_start(l5, &data) && data == INT_MIN);
+    assert(SUCCESS == get_end(l5, &data) && data == INT_MAX);
+    destroy_list(&l5);
+
+    // Walk over l3 once with a cursor, erase the odd elements and repeat the even ones
+    cursor_init(&cursor, l3);
+    while (SUCCESS == cursor_get(&cursor, &data))
+    {
+        if (data % 2 != 0)
+            cursor_erase(&cursor);
+        else
+        {
+            cursor_insert_after(&cursor, data);
+            cursor_next(&cursor);
+            cursor_next(&cursor);
+        }
+    }
+    show(l3, "After erasing the odd elements of l3 and repeating the even ones : ");
+
+    // Remove every occurrence of the first and the last element of l3 in one pass
+    assert(SUCCESS == get_start(l3, &keys[0]));
+    assert(SUCCESS == get_end(l3, &keys[1]));
+    length = size(l3);
+    length = length - remove_all_in(l3, keys, 2);
+    assert(size(l3) == length);
+    assert(!search_data(l3, keys[0]) && !search_data(l3, keys[1]));
+    show(l3, "After removing the first and the last element of l3 : ");
+
+    // Halve the multiples of four of l3 and keep the first ten in l2, in a single pass over l3
+    pipeline_init(&pipeline, l3);
+    pipeline_take(pipeline_map(pipeline_filter(&pipeline, is_multiple_of_four, NULL), halve, NULL), 10);
+    destroy_list(&l2);
+    l2 = pipeline_to_list(&pipeline);
+    assert(size(l2) == pipeline_count(&pipeline));
+    show(l2, "First ten halves of the multiples of four of l3 in l2 : ");
+    printf("Sum of the elements of l2 : %d\n", pipeline_reduce(&pipeline, add, 0, NULL));
+
+    // Destroy the lists l1, l2, l3 and l4 and free memory
     destroy_list(&l1);
     destroy_list(&l2);
     destroy_list(&l3);
+    destroy_list(&l4);
+
+    // Counters of the operations, all zero unless built with LIST_STATS
+    list_stats_dump_json(stdout);
+
+    // Every list is destroyed, so every node taken from the pools was given back
+    list_stats_get(&stats);
+    if (stats.enabled)
+    {
+        assert(stats.nr_node_allocs > 0);
+        assert(stats.nr_node_allocs == stats.nr_node_frees);
+        assert(stats.ops[STATS_INSERT_END].nr_calls > 0);
+    }
+
+    // Known operations move the counters by known amounts
+    list_stats_reset();
+    l1 = create_list();
+    for (data_t i = 1; i <= 8; ++i)
+        insert_end(l1, i);
+    assert(SUCCESS == remove_data(l1, 8));
+    assert(search_data(l1, 5));
+    keys[0] = 2;
+    keys[1] = 3;
+    assert(2 == remove_all_in(l1, keys, 2));
+    destroy_list(&l1);
+    list_stats_get(&stats);
+    if (stats.enabled)
+    {
+        assert(stats.ops[STATS_INSERT_END].nr_calls == 8);
+        assert(stats.ops[STATS_REMOVE_DATA].nr_calls == 1);
+        assert(stats.ops[STATS_SEARCH_DATA].nr_calls == 1);
+        assert(stats.walked[STATS_WALK_SEARCH] > 0);
+        assert(stats.nr_node_allocs == 8 && stats.nr_node_frees == 8);
+        assert(stats.nr_lists_destroyed == 1);
+    }
+    else
+        assert(stats.nr_node_allocs == 0 && stats.ops[STATS_INSERT_END].nr_calls == 0);
     
     // End of the program
     puts("PROGRAM END");
@@ -0,0 +1,727 @@
+/**
+ * @file list.c
+ * @author Akash_Thorat
+ * @brief Implementation of an unrolled linked list data structure and associated functions.
+ * @version 0.1
+ * @date 2024-04-22
+ *
+ * This file contains the implementation of an unrolled linked list along with
+ * various functions for manipulating and operating on the list. It provides
+ * functions for creating a new list, inserting elements at the beginning and end,
+ * removing elements, searching for elements, adding two list, concating one list to another,
+ * revering the list, sorting the list, and more.
+ *
+ * Every node holds up to NODE_CAPACITY elements. Appending to a full node starts a
+ * new node, inserting in the middle of a full node splits it in two halves, and a
+ * node which becomes less than half full after a deletion takes over the elements
+ * of its successor when they fit, so the nodes stay densely filled. Like the
+ * Singly_Linked_List, the list header owns a dummy node, tracks the last node and
+ * the number of elements, and the nodes are taken from a slab based pool (pool.c).
+ * Searching compares a key against a whole node at once with the vector kernels
+ * of simd.c. parallel_sort() sorts segments of the flattened elements on the threads
+ * of the worker pool (workers.c) and merges them pairwise in rounds, each round
+ * between two arrays. Every merge is split by rank into parts merged in parallel.
+ *
+ * This file serves as the backend implementation for the unrolled linked list and
+ * is intended to be used in conjunction with the corresponding header file (list.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+#include "pool.h"
+#include "simd.h"
+#include "workers.h"
+
+// Function to create a new list with a dummy node and a private node pool
+list_t* create_list(void)
+{
+    list_t* p_list = NULL;
+
+    p_list = create_list_with_pool(create_pool());
+    p_list->owns_pool = 1;
+
+    return (p_list);
+}
+
+// Function to create a new list with a dummy node, nodes are taken from p_pool
+list_t* create_list_with_pool(struct pool* p_pool)
+{
+    list_t* p_list = NULL;
+
+    p_list = (list_t*) xcalloc(1, sizeof(list_t));
+    p_list->head.nr_data = 0;            // Initialize the dummy node
+    p_list->head.next = NULL;
+    p_list->p_tail = &p_list->head;
+    p_list->nr_elements = 0;
+    p_list->p_pool = p_pool;
+    p_list->owns_pool = 0;
+
+    return (p_list);
+}
+
+// Insert a new element at the beginning of the list
+status_t insert_start(list_t* p_list, data_t new_data)
+{
+    node_t* p_first = NULL;
+
+    p_first = p_list->head.next;
+    if (p_first == NULL || p_first->nr_data == NODE_CAPACITY)
+        p_first = get_new_node(p_list, &p_list->head);
+    generic_insert(p_list, p_first, 0, new_data);
+    return (SUCCESS);
+}
+
+// Insert a new element at the end of the list
+status_t insert_end(list_t* p_list, data_t new_data)
+{
+    node_t* p_last = NULL;
+
+    p_last = p_list->p_tail;
+    if (p_last == &p_list->head || p_last->nr_data == NODE_CAPACITY)
+        p_last = get_new_node(p_list, p_last);
+    generic_insert(p_list, p_last, p_last->nr_data, new_data);
+    return (SUCCESS);
+}
+
+// Insert new_data after the first occurrence of e_data in the list
+status_t insert_after(list_t* p_list, data_t e_data, data_t new_data)
+{
+    node_t* e_node = NULL;
+    len_t index = 0;
+
+    e_node = search_node(p_list, e_data, NULL, &index);
+    if (e_node == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    generic_insert(p_list, e_node, index + 1, new_data);
+    return (SUCCESS);
+}
+
+// Insert new_data before the first occurrence of e_data in the list
+status_t insert_before(list_t* p_list, data_t e_data, data_t new_data)
+{
+    node_t* e_node = NULL;
+    len_t index = 0;
+
+    e_node = search_node(p_list, e_data, NULL, &index);
+    if (e_node == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    generic_insert(p_list, e_node, index, new_data);
+    return (SUCCESS);
+}
+
+// Get the first element of the list
+status_t get_start(list_t* p_list, data_t* p_start_data)
+{
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    *p_start_data = p_list->head.next->data[0];
+    return (SUCCESS);
+}
+
+// Get the last element of the list
+status_t get_end(list_t* p_list, data_t* p_end_data)
+{
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    *p_end_data = p_list->p_tail->data[p_list->p_tail->nr_data - 1];
+    return (SUCCESS);
+}
+
+// Remove and return the first element of the list
+status_t pop_start(list_t* p_list, data_t* p_start_data)
+{
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    *p_start_data = p_list->head.next->data[0];
+    generic_delete(p_list, &p_list->head, p_list->head.next, 0);
+    return (SUCCESS);
+}
+
+// Remove and return the last element of the list
+status_t pop_end(list_t* p_list, data_t* p_end_data)
+{
+    node_t* p_last = NULL;
+
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    p_last = p_list->p_tail;
+    *p_end_data = p_last->data[p_last->nr_data - 1];
+    generic_delete(p_list, NULL, p_last, p_last->nr_data - 1);
+    return (SUCCESS);
+}
+
+// Remove the first element of the list
+status_t remove_start(list_t* p_list)
+{
+    data_t data = 0;
+    return (pop_start(p_list, &data));
+}
+
+// Remove the last element of the list
+status_t remove_end(list_t* p_list)
+{
+    data_t data = 0;
+    return (pop_end(p_list, &data));
+}
+
+// Remove the first occurrence of r_data from the list
+status_t remove_data(list_t* p_list, data_t r_data)
+{
+    node_t* p_remove_node = NULL;
+    node_t* p_prev = NULL;
+    len_t index = 0;
+
+    if (is_list_empty(p_list))
+        return (LIST_EMPTY);
+    p_remove_node = search_node(p_list, r_data, &p_prev, &index);
+    if (p_remove_node == NULL)
+        return (LIST_DATA_NOT_FOUND);
+    generic_delete(p_list, p_prev, p_remove_node, index);
+    return (SUCCESS);
+}
+
+// Search for f_data in the list
+int search_data(list_t* p_list, data_t f_data)
+{
+    len_t index = 0;
+    return (search_node(p_list, f_data, NULL, &index) != NULL);
+}
+
+// Count the occurrences of c_data in the list
+len_t count_data(list_t* p_list, data_t c_data)
+{
+    node_t* p_run = NULL;
+    len_t count = 0;
+
+    for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+        count = count + count_matches(node_match_mask(p_run, c_data));
+    return (count);
+}
+
+// Add given two list in new list and retuen new list
+list_t* add_lists(list_t* p_list_1, list_t* p_list_2)
+{
+    list_t* p_new_list = NULL;
+    node_t* p_run = NULL;
+
+    p_new_list = create_list();
+
+    for(p_run = p_list_1->head.next; p_run != NULL; p_run = p_run->next)
+        for(len_t i = 0; i < p_run->nr_data; ++i)
+            insert_end(p_new_list, p_run->data[i]);
+
+    for(p_run = p_list_2->head.next; p_run != NULL; p_run = p_run->next)
+        for(len_t i = 0; i < p_run->nr_data; ++i)
+            insert_end(p_new_list, p_run->data[i]);
+
+    return (p_new_list);
+}
+
+// Concatenates the second list to the end of the first list
+void concat_lists(list_t* p_list_1, list_t* p_list_2)
+{
+    node_t* p_run = NULL;
+
+    if(is_list_empty(p_list_2))
+        return;
+
+    if(p_list_1->p_pool != p_list_2->p_pool)
+    {
+        if(!p_list_2->owns_pool)
+        {
+            // Nodes of a shared pool can not change owner, copy them instead
+            for(p_run = p_list_2->head.next; p_run != NULL; p_run = p_run->next)
+                for(len_t i = 0; i < p_run->nr_data; ++i)
+                    insert_end(p_list_1, p_run->data[i]);
+            pool_free_chain(p_list_2->p_pool, p_list_2->head.next, p_list_2->p_tail);
+            p_list_2->head.next = NULL;
+            p_list_2->p_tail = &p_list_2->head;
+            p_list_2->nr_elements = 0;
+            return;
+        }
+        pool_merge(p_list_1->p_pool, p_list_2->p_pool);
+    }
+
+    p_list_1->p_tail->next = p_list_2->head.next;
+    p_list_1->p_tail = p_list_2->p_tail;
+    p_list_1->nr_elements = p_list_1->nr_elements + p_list_2->nr_elements;
+
+    p_list_2->head.next = NULL;
+    p_list_2->p_tail = &p_list_2->head;
+    p_list_2->nr_elements = 0;
+}
+
+// Return new list by merging two list
+list_t* get_merged_list(list_t* p_list_1, list_t* p_list_2)
+{
+    list_t* p_list = NULL;
+
+    p_list = add_lists(p_list_1, p_list_2);
+    sort(p_list);
+
+    return (p_list);
+}
+
+// Return Reversed List(Reversed by value)
+list_t* get_reversed_list(list_t* p_list)
+{
+    list_t* p_new_list = NULL;
+    node_t* p_run = NULL;
+
+    p_new_list = create_list();
+    for(p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+        for(len_t i = 0; i < p_run->nr_data; ++i)
+            insert_start(p_new_list, p_run->data[i]);
+
+    return (p_new_list);
+}
+
+// reverce the list(Reversed by node), the elements of every node are reversed as well
+void reverse_list(list_t* p_list)
+{
+    node_t* p_run = NULL;
+    node_t* p_run_next = NULL;
+    node_t* p_prev = NULL;
+    data_t temp = 0;
+
+    if(is_list_empty(p_list))
+        return;
+
+    p_run = p_list->head.next;
+    p_list->p_tail = p_run;      // First node becomes the last one
+
+    while(p_run != NULL)
+    {
+        for(len_t i = 0, j = p_run->nr_data - 1; i < j; ++i, --j)
+        {
+            temp = p_run->data[i];
+            p_run->data[i] = p_run->data[j];
+            p_run->data[j] = temp;
+        }
+        p_run_next = p_run->next;
+        p_run->next = p_prev;
+        p_prev = p_run;
+        p_run = p_run_next;
+    }
+    p_list->head.next = p_prev;
+}
+
+// Sort the list, elements are sorted in a flat array and written back into the nodes
+void sort(list_t* p_list)
+{
+    data_t* p_array = NULL;
+
+    if(size(p_list) <= 1)
+        return;
+
+    p_array = copy_to_array(p_list);
+    qsort(p_array, size(p_list), sizeof(data_t), compare_data);
+    copy_from_array(p_list, p_array);
+    free(p_array);
+}
+
+// Define a sorted run of parallel_sort(), a range of the array holding the current round
+struct sort_segment {
+    len_t begin;                         // Index of the first element of the run
+    len_t length;                        // Number of elements of the run
+};
+
+// Define the state shared by the tasks of parallel_sort()
+struct parallel_sort {
+    data_t* p_data;                      // Array holding the runs of the current round
+    data_t* p_buffer;                    // Array receiving the merged runs, swapped with p_data after every round
+    struct sort_segment* p_runs;         // Runs of the current round
+    int nr_runs;                         // Number of runs of the current round
+    int nr_parts;                        // Number of parts of every merge of the current round
+};
+
+// Define a task of parallel_sort(), it sorts a segment or merges a part of two runs
+struct sort_task {
+    struct parallel_sort* p_sort;        // State shared by the tasks
+    int id;                              // Segment sorted, or merge * nr_parts + part for a merge round
+};
+
+// Sort the list on nr_threads threads of the worker pool, the sorted segments are merged in rounds and every merge is split by rank
+void parallel_sort(list_t* p_list, int nr_threads)
+{
+    struct parallel_sort state;
+    struct sort_task* p_tasks = NULL;
+    len_t length = 0;
+    len_t begin = 0;
+
+    length = size(p_list);
+    if (nr_threads > length / PARALLEL_SORT_MIN_SEGMENT)
+        nr_threads = length / PARALLEL_SORT_MIN_SEGMENT;
+    if (nr_threads <= 1)
+    {
+        sort(p_list);
+        return;
+    }
+
+    state.p_data = copy_to_array(p_list);
+    state.p_buffer = (data_t*) xcalloc(length, sizeof(data_t));
+    state.p_runs = (struct sort_segment*) xcalloc(nr_threads, sizeof(struct sort_segment));
+    state.nr_runs = nr_threads;
+    p_tasks = (struct sort_task*) xcalloc(nr_threads, sizeof(struct sort_task));
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        state.p_runs[i].begin = begin;
+        state.p_runs[i].length = length / nr_threads + (i < length % nr_threads);
+        begin = begin + state.p_runs[i].length;
+        p_tasks[i].p_sort = &state;
+        p_tasks[i].id = i;
+    }
+
+    workers_run(sort_segment_task, p_tasks, sizeof(struct sort_task), nr_threads);
+    while (state.nr_runs > 1)
+        merge_round(&state, p_tasks, nr_threads);
+
+    copy_from_array(p_list, state.p_data);
+    free(p_tasks);
+    free(state.p_runs);
+    free(state.p_buffer);
+    free(state.p_data);
+}
+
+// Copy the elements into one contiguous block of full nodes in traversal order, so that walking the list reads memory sequentially
+void compact_list(list_t* p_list)
+{
+    pool_t* p_pool = NULL;
+    node_t* p_block = NULL;
+    node_t* p_run = NULL;
+    node_t* p_dest = NULL;
+    len_t nr_nodes = 0;
+
+    if (size(p_list) == 0)
+        return;
+
+    // A private pool is replaced, which releases the scattered slabs
+    nr_nodes = (size(p_list) + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    p_pool = p_list->owns_pool ? create_pool() : p_list->p_pool;
+    p_block = pool_alloc_block(p_pool, nr_nodes);
+    p_dest = p_block;
+    for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+    {
+        for (int i = 0; i < p_run->nr_data; ++i)
+        {
+            if (p_dest->nr_data == NODE_CAPACITY)
+            {
+                p_dest->next = p_dest + 1;
+                p_dest = p_dest + 1;
+            }
+            p_dest->data[p_dest->nr_data] = p_run->data[i];
+            p_dest->nr_data = p_dest->nr_data + 1;
+        }
+    }
+    p_dest->next = NULL;
+
+    if (p_list->owns_pool)
+    {
+        destroy_pool(&p_list->p_pool);
+        p_list->p_pool = p_pool;
+    }
+    else
+        pool_free_chain(p_pool, p_list->head.next, p_list->p_tail);
+    p_list->head.next = p_block;
+    p_list->p_tail = p_dest;
+}
+
+// Check if the list is empty
+int is_list_empty(list_t* p_list)
+{
+    return (p_list->head.next == NULL);
+}
+
+// Get the size/length of the list
+len_t size(list_t* p_list)
+{
+    return (p_list->nr_elements);
+}
+
+// Display the contents of the list
+void show(list_t* p_list, const char* msg)
+{
+    node_t* p_run = NULL;
+    if (msg)
+        puts(msg);
+    printf("[START]->");
+    for (p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+        for (len_t i = 0; i < p_run->nr_data; ++i)
+            printf("[%d]->", p_run->data[i]);
+    puts("[END]");
+}
+
+// Destroy the list and give its nodes back to the pool
+status_t destroy_list(list_t** pp_list)
+{
+    list_t* p_list = NULL;
+
+    p_list = *pp_list;
+    if (p_list->owns_pool)
+        destroy_pool(&p_list->p_pool);
+    else if (!is_list_empty(p_list))
+        pool_free_chain(p_list->p_pool, p_list->head.next, p_list->p_tail);
+    free(p_list);
+    *pp_list = NULL;
+    return (SUCCESS);
+}
+
+//----------------HELPER RUTINES-----------------
+
+// Insert new_data at position index of p_node, a full node is split first
+static void generic_insert(list_t* p_list, node_t* p_node, len_t index, data_t new_data)
+{
+    if (p_node->nr_data == NODE_CAPACITY)
+    {
+        split_node(p_list, p_node);
+        if (index > p_node->nr_data)
+        {
+            index = index - p_node->nr_data;
+            p_node = p_node->next;
+        }
+    }
+
+    memmove(&p_node->data[index + 1], &p_node->data[index], (p_node->nr_data - index) * sizeof(data_t));
+    p_node->data[index] = new_data;
+    p_node->nr_data = p_node->nr_data + 1;
+    p_list->nr_elements = p_list->nr_elements + 1;
+}
+
+// Delete the element at position index of p_node, p_prev may be NULL if unknown
+static void generic_delete(list_t* p_list, node_t* p_prev, node_t* p_node, len_t index)
+{
+    node_t* p_next = NULL;
+
+    memmove(&p_node->data[index], &p_node->data[index + 1], (p_node->nr_data - index - 1) * sizeof(data_t));
+    p_node->nr_data = p_node->nr_data - 1;
+    p_list->nr_elements = p_list->nr_elements - 1;
+
+    if (p_node->nr_data == 0)
+    {
+        // Unlink the empty node
+        if (p_prev == NULL)
+            p_prev = get_prev_node(p_list, p_node);
+        p_prev->next = p_node->next;
+        if (p_list->p_tail == p_node)
+            p_list->p_tail = p_prev;
+        pool_free(p_list->p_pool, p_node);
+        return;
+    }
+
+    p_next = p_node->next;
+    if (p_node->nr_data < NODE_CAPACITY / 2 && p_next != NULL &&
+        p_node->nr_data + p_next->nr_data <= NODE_CAPACITY)
+    {
+        // Take over the elements of the next node and unlink it
+        memcpy(&p_node->data[p_node->nr_data], p_next->data, p_next->nr_data * sizeof(data_t));
+        p_node->nr_data = p_node->nr_data + p_next->nr_data;
+        p_node->next = p_next->next;
+        if (p_list->p_tail == p_next)
+            p_list->p_tail = p_node;
+        pool_free(p_list->p_pool, p_next);
+    }
+}
+
+// Search for the first node containing s_data, its position is stored in p_index
+static node_t* search_node(list_t* p_list, data_t s_data, node_t** pp_prev, len_t* p_index)
+{
+    node_t* p_prev = NULL;
+    node_t* p_run = NULL;
+    unsigned int mask = 0;
+
+    p_prev = &p_list->head;
+    for (p_run = p_list->head.next; p_run != NULL; p_prev = p_run, p_run = p_run->next)
+    {
+        mask = node_match_mask(p_run, s_data);
+        if (mask != 0)
+        {
+            if (pp_prev != NULL)
+                *pp_prev = p_prev;
+            *p_index = first_match(mask);
+            return (p_run);
+        }
+    }
+    return (NULL);
+}
+
+// Create a new empty node and link it after p_prev
+static node_t* get_new_node(list_t* p_list, node_t* p_prev)
+{
+    node_t* p_new_node = NULL;
+
+    p_new_node = pool_alloc(p_list->p_pool);
+    p_new_node->nr_data = 0;
+    p_new_node->next = p_prev->next;
+    p_prev->next = p_new_node;
+    if (p_list->p_tail == p_prev)
+        p_list->p_tail = p_new_node;
+    return (p_new_node);
+}
+
+// Get the node before p_node (the dummy node for the first node)
+static node_t* get_prev_node(list_t* p_list, node_t* p_node)
+{
+    node_t* p_prev = NULL;
+    p_prev = &p_list->head;
+    while (p_prev->next != p_node)
+        p_prev = p_prev->next;
+    return (p_prev);
+}
+
+// Move the upper half of the elements of p_node into a new node after it
+static void split_node(list_t* p_list, node_t* p_node)
+{
+    node_t* p_new_node = NULL;
+    len_t half = 0;
+
+    half = p_node->nr_data / 2;
+    p_new_node = get_new_node(p_list, p_node);
+    memcpy(p_new_node->data, &p_node->data[half], (p_node->nr_data - half) * sizeof(data_t));
+    p_new_node->nr_data = p_node->nr_data - half;
+    p_node->nr_data = half;
+}
+
+// Compare two elements for qsort
+static int compare_data(const void* p_data_1, const void* p_data_2)
+{
+    data_t data_1 = *(const data_t*) p_data_1;
+    data_t data_2 = *(const data_t*) p_data_2;
+    return ((data_1 > data_2) - (data_1 < data_2));
+}
+
+// Copy the elements of the list, in order, to a new array
+static data_t* copy_to_array(list_t* p_list)
+{
+    data_t* p_array = NULL;
+    node_t* p_run = NULL;
+    len_t length = 0;
+
+    p_array = (data_t*) xcalloc(size(p_list), sizeof(data_t));
+    for(p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+    {
+        memcpy(p_array + length, p_run->data, p_run->nr_data * sizeof(data_t));
+        length = length + p_run->nr_data;
+    }
+    return (p_array);
+}
+
+// Overwrite the elements of the list, in order, from an array, the nodes keep their fill
+static void copy_from_array(list_t* p_list, const data_t* p_array)
+{
+    node_t* p_run = NULL;
+    len_t length = 0;
+
+    for(p_run = p_list->head.next; p_run != NULL; p_run = p_run->next)
+    {
+        memcpy(p_run->data, p_array + length, p_run->nr_data * sizeof(data_t));
+        length = length + p_run->nr_data;
+    }
+}
+
+// Merge the sorted arrays p_run1 and p_run2 into p_out, equal elements keep their order
+static void merge_arrays(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, data_t* p_out)
+{
+    len_t i = 0;
+    len_t j = 0;
+
+    while (i < length1 && j < length2)
+        *p_out++ = (p_run1[i] <= p_run2[j]) ? p_run1[i++] : p_run2[j++];
+    memcpy(p_out, p_run1 + i, (length1 - i) * sizeof(data_t));
+    memcpy(p_out + (length1 - i), p_run2 + j, (length2 - j) * sizeof(data_t));
+}
+
+// Sort one segment of the array
+static void sort_segment_task(void* p_task)
+{
+    struct sort_task* p_this = (struct sort_task*) p_task;
+    struct parallel_sort* p_sort = p_this->p_sort;
+    struct sort_segment* p_run = &p_sort->p_runs[p_this->id];
+
+    qsort(p_sort->p_data + p_run->begin, p_run->length, sizeof(data_t), compare_data);
+}
+
+// Merge the runs pairwise into the other array, every merge is split into parts merged by separate tasks
+static void merge_round(struct parallel_sort* p_sort, struct sort_task* p_tasks, int nr_threads)
+{
+    // An odd run is merged with an empty one, so the tasks copy it as well
+    int nr_merges = (p_sort->nr_runs + 1) / 2;
+    data_t* p_swap = NULL;
+
+    p_sort->nr_parts = nr_threads / nr_merges;
+    workers_run(merge_part_task, p_tasks, sizeof(struct sort_task), nr_merges * p_sort->nr_parts);
+
+    // Run i is read before it is overwritten, by merge i / 2
+    for (int i = 0; i < nr_merges; ++i)
+    {
+        p_sort->p_runs[i].begin = p_sort->p_runs[2 * i].begin;
+        p_sort->p_runs[i].length = p_sort->p_runs[2 * i].length;
+        if (2 * i + 1 < p_sort->nr_runs)
+            p_sort->p_runs[i].length = p_sort->p_runs[i].length + p_sort->p_runs[2 * i + 1].length;
+    }
+    p_sort->nr_runs = nr_merges;
+
+    p_swap = p_sort->p_data;
+    p_sort->p_data = p_sort->p_buffer;
+    p_sort->p_buffer = p_swap;
+}
+
+// Merge one part of two adjacent runs into the other array, the part is found by rank in both runs
+static void merge_part_task(void* p_task)
+{
+    struct sort_task* p_this = (struct sort_task*) p_task;
+    struct parallel_sort* p_sort = p_this->p_sort;
+    int merge = p_this->id / p_sort->nr_parts;
+    int part = p_this->id % p_sort->nr_parts;
+    struct sort_segment* p_run = &p_sort->p_runs[2 * merge];
+    const data_t* p_run1 = p_sort->p_data + p_run->begin;
+    const data_t* p_run2 = p_run1 + p_run->length;
+    len_t length1 = p_run->length;
+    len_t length2 = (2 * merge + 1 < p_sort->nr_runs) ? p_run[1].length : 0;
+    len_t begin = part_rank(length1 + length2, part, p_sort->nr_parts);
+    len_t end = part_rank(length1 + length2, part + 1, p_sort->nr_parts);
+    len_t begin1 = split_rank(p_run1, length1, p_run2, length2, begin);
+    len_t end1 = split_rank(p_run1, length1, p_run2, length2, end);
+
+    merge_arrays(p_run1 + begin1, end1 - begin1, p_run2 + (begin - begin1), (end - end1) - (begin - begin1),
+                 p_sort->p_buffer + p_run->begin + begin);
+}
+
+// Return how many elements of p_run1 come first among the first rank elements of the merge of both runs
+static len_t split_rank(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, len_t rank)
+{
+    len_t low = (rank > length2) ? rank - length2 : 0;
+    len_t high = (rank < length1) ? rank : length1;
+    len_t mid = 0;
+
+    // Binary search into both runs, the element of p_run1 goes first when they are equal
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+        if (p_run1[mid] <= p_run2[rank - mid - 1])
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return (low);
+}
+
+// Return the first rank of a part when total elements are split into nr_parts parts
+static len_t part_rank(len_t total, int part, int nr_parts)
+{
+    return ((len_t) ((long long) total * part / nr_parts));
+}
+
+// Allocate memory for an array with specified number of elements and size per element
+void* xcalloc(int nr_of_element, len_t size_per_element)
+{
+    void* p = NULL;
+    p = calloc(nr_of_element, size_per_element);
+    if (p == NULL)
+    {
+        puts("ERROR while allocating memory ..!");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
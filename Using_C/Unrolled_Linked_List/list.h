@@ -0,0 +1,111 @@
+/**
+ * @file list.h
+ * @author Akash_Thorat
+ * @brief Header file defining an unrolled linked list data structure and associated functions.
+ * @version 0.1
+ * @date 2024-04-22
+ *
+ * This header file contains the declarations for an unrolled linked list, a singly
+ * linked list in which every node stores a block of elements instead of a single one.
+ * A node is sized to fill one cache line, so traversals read several elements per
+ * pointer hop and the per element memory overhead is a fraction of the one of the
+ * Singly_Linked_List. It provides the same interface as the Singly_Linked_List for
+ * creating a new list, inserting elements, removing elements, searching for
+ * elements, sorting the list, and more.
+ *
+ * Additionally, the header file defines helper routines used internally by the
+ * interface functions and includes necessary typedefs and structure definitions.
+ *
+ * This header file serves as the interface for using the unrolled linked list and
+ * is intended to be included in source files where linked list functionality is
+ * required. It should be used in conjunction with the corresponding source file
+ * (list.c) for full functionality.
+ */
+
+
+#ifndef _LIST_H
+#define _LIST_H
+
+#define CACHE_LINE_SIZE 64      // Size of a node in bytes
+#define PARALLEL_SORT_MIN_SEGMENT 4096   // Smallest number of elements sorted by one thread of parallel_sort()
+#define NODE_CAPACITY ((int) ((CACHE_LINE_SIZE - sizeof(struct node*) - sizeof(int)) / sizeof(int)))  // Elements per node
+
+// Define the structure of a node in the unrolled linked list
+struct node {
+    struct node* next;          // Pointer to the next node in the list
+    int nr_data;                // Number of elements stored in the node
+    int data[NODE_CAPACITY];    // Elements stored in the node, data[0 ... nr_data - 1] are valid
+};
+
+struct pool;                 // Node pool, defined in pool.h
+struct sort_segment;         // Sorted run of parallel_sort(), defined in list.c
+struct parallel_sort;        // State of parallel_sort(), defined in list.c
+struct sort_task;            // Task of parallel_sort(), defined in list.c
+
+// Define the header of the linked list, kept separate from the nodes
+struct list {
+    struct node head;        // Dummy node, head.next is the first node of the list
+    struct node* p_tail;     // Pointer to the last node (&head when the list is empty)
+    int nr_elements;         // Number of elements currently in the list
+    struct pool* p_pool;     // Pool from which the nodes of the list are allocated
+    int owns_pool;           // Non zero if the pool is private to this list
+};
+
+// Define typedefs for clarity and abstraction
+typedef enum status {SUCCESS = 1, LIST_EMPTY, LIST_DATA_NOT_FOUND} status_t;  // Status codes for list operations
+typedef struct node node_t;  // Typedef for node structure
+typedef struct list list_t;   // Typedef for the entire linked list
+typedef int data_t;           // Typedef for data stored in nodes
+typedef int len_t;            // Typedef for length/size of the list
+
+// Function prototypes for the operations that can be performed on the list
+list_t* create_list(void);  // Create a new linked list
+list_t* create_list_with_pool(struct pool* p_pool);         // Create a new linked list which takes its nodes from a shared pool
+status_t insert_start(list_t* p_list, data_t new_data);     // Insert data at the beginning of the list
+status_t insert_end(list_t* p_list, data_t new_data);       // Insert data at the end of the list
+status_t insert_after(list_t* p_list, data_t e_data, data_t new_data);  // Insert data after a specific value
+status_t insert_before(list_t* p_list, data_t e_data, data_t new_data); // Insert data before a specific value
+status_t get_start(list_t* p_list, data_t* p_start_data);   // Get the first element of the list
+status_t get_end(list_t* p_list, data_t* p_end_data);       // Get the last element of the list
+status_t pop_start(list_t* p_list, data_t* p_start_data);   // Remove and retrieve the first element of the list
+status_t pop_end(list_t* p_list, data_t* p_end_data);       // Remove and retrieve the last element of the list
+status_t remove_start(list_t* p_list);                      // Remove the first element of the list
+status_t remove_end(list_t* p_list);                        // Remove the last element of the list
+status_t remove_data(list_t* p_list, data_t r_data);         // Remove a specific value from the list
+int search_data(list_t* p_list, data_t f_data);             // Search for a specific value in the list
+len_t count_data(list_t* p_list, data_t c_data);            // Count the occurrences of a specific value in the list
+
+list_t* add_lists(list_t* p_list_1, list_t* p_list_2);      // Add given two list in new list and retuen new list
+void concat_lists(list_t* p_list_1, list_t* p_list_2);      // Concatenates the second list to the end of the first list 
+list_t* get_merged_list(list_t* p_list_1, list_t* p_list_2); // Return new list by merging two list
+list_t* get_reversed_list(list_t* p_list);             // Return Reversed List(Reversed by value)
+void reverse_list(list_t* p_list);                     // reverce the list(Reversed by node)
+void sort(list_t* p_list);                                  // Sort the list
+void parallel_sort(list_t* p_list, int nr_threads);         // Sort the list on nr_threads threads, same result as sort()
+void compact_list(list_t* p_list);                          // Move the elements into one block of full nodes, in traversal order
+
+int is_list_empty(list_t* p_list);                          // Check if the list is empty
+len_t size(list_t* p_list);                                 // Get the size/length of the list
+void show(list_t* p_list, const char* msg);                  // Display the contents of the list
+status_t destroy_list(list_t** pp_list);                    // Destroy the list and free memory
+
+
+// Helper routines used internally by the interface functions
+static void generic_insert(list_t* p_list, node_t* p_node, len_t index, data_t new_data);  // Insert data at index of a node
+static void generic_delete(list_t* p_list, node_t* p_prev, node_t* p_node, len_t index);   // Delete data at index of a node
+static node_t* search_node(list_t* p_list, data_t s_data, node_t** pp_prev, len_t* p_index); // Search for the node containing specific data
+static node_t* get_new_node(list_t* p_list, node_t* p_prev);        // Create a new empty node after p_prev
+static node_t* get_prev_node(list_t* p_list, node_t* p_node);       // Get the node before p_node
+static void split_node(list_t* p_list, node_t* p_node);             // Move the upper half of a full node into a new node
+static int compare_data(const void* p_data_1, const void* p_data_2); // Compare two elements for qsort
+static data_t* copy_to_array(list_t* p_list);                       // Copy the elements of the list to a new array
+static void copy_from_array(list_t* p_list, const data_t* p_array); // Overwrite the elements of the list from an array
+static void merge_arrays(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, data_t* p_out); // Merge two sorted arrays
+static void sort_segment_task(void* p_task);                         // Sort one segment of parallel_sort()
+static void merge_round(struct parallel_sort* p_sort, struct sort_task* p_tasks, int nr_threads); // Merge the runs of parallel_sort() pairwise
+static void merge_part_task(void* p_task);                          // Merge one part of two runs
+static len_t split_rank(const data_t* p_run1, len_t length1, const data_t* p_run2, len_t length2, len_t rank); // Elements of p_run1 among the first rank merged elements
+static len_t part_rank(len_t total, int part, int nr_parts);        // First rank of a part of a merge
+void* xcalloc(int nr_of_elemet, len_t size_per_element);             // Helper function to allocate memory
+
+#endif /*_LIST_H*/
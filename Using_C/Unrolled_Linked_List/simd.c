@@ -0,0 +1,157 @@
+/**
+ * @file simd.c
+ * @author Akash_Thorat
+ * @brief Implementation of the vectorized search kernels of the unrolled linked list.
+ * @version 0.1
+ * @date 2024-04-24
+ *
+ * This file contains the implementation of the match kernels. A node holds
+ * NODE_CAPACITY elements, which is not a multiple of the vector width, so the
+ * vector kernels compare full vectors from the start of the node and finish with
+ * one vector ending at the last element, overlapping the previous one. This way
+ * no load reads past the end of a node. Bits of elements past nr_data are
+ * cleared by node_match_mask().
+ *
+ * The AVX2 kernel is compiled with a target attribute, so the file builds without
+ * any extra compiler flag and the AVX2 instructions only run when the processor
+ * supports them.
+ *
+ * This file is intended to be used in conjunction with the corresponding header
+ * file (simd.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+static match_kernel_t p_match_kernel = NULL;       // Kernel in use, selected on first use
+static const char* p_kernel_name = "none";         // Name of the kernel in use
+
+// Get the mask of the elements of p_node which are equal to key
+unsigned int node_match_mask(const node_t* p_node, data_t key)
+{
+    if (p_match_kernel == NULL)
+        select_kernel();
+    return (p_match_kernel(p_node->data, key) & ((1u << p_node->nr_data) - 1));
+}
+
+// Get the index of the lowest set bit of a non zero mask
+len_t first_match(unsigned int mask)
+{
+#if defined(__GNUC__)
+    return (__builtin_ctz(mask));
+#else
+    len_t index = 0;
+    while ((mask & 1u) == 0)
+    {
+        mask = mask >> 1;
+        index = index + 1;
+    }
+    return (index);
+#endif
+}
+
+// Get the number of set bits of a mask
+len_t count_matches(unsigned int mask)
+{
+#if defined(__GNUC__)
+    return (__builtin_popcount(mask));
+#else
+    len_t count = 0;
+    for (; mask != 0; mask = mask & (mask - 1))
+        count = count + 1;
+    return (count);
+#endif
+}
+
+// Get the name of the kernel in use
+const char* simd_kernel_name(void)
+{
+    if (p_match_kernel == NULL)
+        select_kernel();
+    return (p_kernel_name);
+}
+
+#ifdef SIMD_X86
+// SSE2 kernel, compares 4 elements per instruction
+static unsigned int match_sse2(const data_t* p_data, data_t key)
+{
+    __m128i v_key = _mm_set1_epi32(key);
+    __m128i v_cmp;
+    unsigned int mask = 0;
+    len_t i = 0;
+
+    for (i = 0; i + 4 <= (len_t) NODE_CAPACITY; i += 4)
+    {
+        v_cmp = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) (p_data + i)), v_key);
+        mask |= (unsigned int) _mm_movemask_ps(_mm_castsi128_ps(v_cmp)) << i;
+    }
+    if (NODE_CAPACITY % 4 != 0)
+    {
+        i = NODE_CAPACITY - 4;
+        v_cmp = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) (p_data + i)), v_key);
+        mask |= (unsigned int) _mm_movemask_ps(_mm_castsi128_ps(v_cmp)) << i;
+    }
+    return (mask);
+}
+
+// AVX2 kernel, compares 8 elements per instruction
+__attribute__((target("avx2")))
+static unsigned int match_avx2(const data_t* p_data, data_t key)
+{
+    __m256i v_key = _mm256_set1_epi32(key);
+    __m256i v_cmp;
+    unsigned int mask = 0;
+    len_t i = 0;
+
+    for (i = 0; i + 8 <= (len_t) NODE_CAPACITY; i += 8)
+    {
+        v_cmp = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (p_data + i)), v_key);
+        mask |= (unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(v_cmp)) << i;
+    }
+    if (NODE_CAPACITY % 8 != 0)
+    {
+        i = NODE_CAPACITY - 8;
+        v_cmp = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (p_data + i)), v_key);
+        mask |= (unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(v_cmp)) << i;
+    }
+    return (mask);
+}
+#endif
+
+//----------------HELPER RUTINES-----------------
+
+// Portable kernel, compares one element at a time
+static unsigned int match_scalar(const data_t* p_data, data_t key)
+{
+    unsigned int mask = 0;
+    for (len_t i = 0; i < (len_t) NODE_CAPACITY; ++i)
+        if (p_data[i] == key)
+            mask |= 1u << i;
+    return (mask);
+}
+
+// Select the widest kernel supported by the processor
+static void select_kernel(void)
+{
+    p_match_kernel = match_scalar;
+    p_kernel_name = "scalar";
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        p_match_kernel = match_avx2;
+        p_kernel_name = "avx2";
+    }
+    else if (__builtin_cpu_supports("sse2"))
+    {
+        p_match_kernel = match_sse2;
+        p_kernel_name = "sse2";
+    }
+#endif
+}
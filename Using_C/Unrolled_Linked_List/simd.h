@@ -0,0 +1,36 @@
+/**
+ * @file simd.h
+ * @author Akash_Thorat
+ * @brief Header file declaring the vectorized search kernels of the unrolled linked list.
+ * @version 0.1
+ * @date 2024-04-24
+ *
+ * This header file contains the declarations for the kernels which compare a key
+ * against all elements of a node at once. Every kernel returns a bit mask in which
+ * bit i is set when data[i] of the node is equal to the key, from which searching,
+ * removing and counting take the first set bit or the number of set bits.
+ *
+ * An AVX2 kernel (8 elements per compare) and an SSE2 kernel (4 elements per
+ * compare) are provided on x86 processors, together with a portable scalar kernel.
+ * The kernel is chosen at run time from the features of the processor the first
+ * time a node is searched.
+ */
+
+#ifndef _SIMD_H
+#define _SIMD_H
+
+#include "list.h"
+
+typedef unsigned int (*match_kernel_t)(const data_t* p_data, data_t key);  // Typedef for a match kernel
+
+// Function prototypes for the operations on the elements of a node
+unsigned int node_match_mask(const node_t* p_node, data_t key);     // Get the mask of elements of a node equal to key
+len_t first_match(unsigned int mask);                               // Get the index of the lowest set bit of a non zero mask
+len_t count_matches(unsigned int mask);                             // Get the number of set bits of a mask
+const char* simd_kernel_name(void);                                 // Get the name of the kernel in use
+
+// Helper routines used internally by the interface functions
+static unsigned int match_scalar(const data_t* p_data, data_t key); // Portable kernel
+static void select_kernel(void);                                    // Select the kernel from the processor features
+
+#endif /*_SIMD_H*/